@@ -0,0 +1,18 @@
+# vector_dbc_generate(<header> <dbc> [NAMESPACE <namespace>])
+#
+# Adds a custom command that generates <header> from the DBC file <dbc>
+# using vector_dbc_codegen. The header contains one packed struct per
+# message with inline pack()/unpack() functions. Add <header> to the
+# sources of a target to trigger the generation.
+function(vector_dbc_generate header dbc)
+    cmake_parse_arguments(ARG "" "NAMESPACE" "" ${ARGN})
+    if(NOT ARG_NAMESPACE)
+        set(ARG_NAMESPACE dbc)
+    endif()
+
+    add_custom_command(
+        OUTPUT ${header}
+        COMMAND vector_dbc_codegen ${dbc} ${header} ${ARG_NAMESPACE}
+        DEPENDS vector_dbc_codegen ${dbc}
+        COMMENT "Generating ${header} from ${dbc}")
+endfunction()
@@ -23,3 +23,57 @@
 
 /* Network */
 #include <Vector/DBC/Network.h>
+
+/* Mapped File */
+#include <Vector/DBC/MappedFile.h>
+
+/* Attribute Resolver */
+#include <Vector/DBC/AttributeResolver.h>
+
+/* Attribute Table */
+#include <Vector/DBC/AttributeTable.h>
+
+/* Attribute Relation Index */
+#include <Vector/DBC/AttributeRelationIndex.h>
+
+/* Relation Index */
+#include <Vector/DBC/RelationIndex.h>
+
+/* Layout Validator */
+#include <Vector/DBC/LayoutValidator.h>
+
+/* CAN FD */
+#include <Vector/DBC/CanFd.h>
+
+/* Multiplex Index */
+#include <Vector/DBC/MultiplexIndex.h>
+
+/* Symbol Table */
+#include <Vector/DBC/SymbolTable.h>
+
+/* Value Description Store */
+#include <Vector/DBC/ValueDescriptionStore.h>
+
+/* Compiled Message */
+#include <Vector/DBC/CompiledMessage.h>
+
+/* Compiled Network */
+#include <Vector/DBC/CompiledNetwork.h>
+
+/* Message Decoder */
+#include <Vector/DBC/MessageDecoder.h>
+
+/* J1939 Index */
+#include <Vector/DBC/J1939Index.h>
+
+/* Message Dispatcher */
+#include <Vector/DBC/MessageDispatcher.h>
+
+/* Message Encoder */
+#include <Vector/DBC/MessageEncoder.h>
+
+/* Batch Decoder */
+#include <Vector/DBC/BatchDecoder.h>
+
+/* Compile-time Signal Codec */
+#include <Vector/DBC/SignalCodec.h>
@@ -24,7 +24,9 @@
 namespace Vector {
 namespace DBC {
 
-bool operator<(const AttributeRelation & lhs, const AttributeRelation & rhs) {
+/** compare the name, relation type and the related objects of the relation type */
+template<typename Relation>
+static bool lessRelation(const Relation & lhs, const Relation & rhs) {
     bool retval = false;
 
     /* compare name */
@@ -77,5 +79,40 @@ bool operator<(const AttributeRelation & lhs, const AttributeRelation & rhs) {
     return retval;
 }
 
+bool operator<(const AttributeRelation & lhs, const AttributeRelation & rhs) {
+    return lessRelation(lhs, rhs);
+}
+
+AttributeRelationKey::AttributeRelationKey(const AttributeRelation & attributeRelation) :
+    name(attributeRelation.name),
+    objectType(attributeRelation.objectType) {
+    switch (objectType) {
+    case AttributeObjectType::Network:
+    case AttributeObjectType::Node:
+    case AttributeObjectType::Message:
+    case AttributeObjectType::Signal:
+    case AttributeObjectType::EnvironmentVariable:
+        /* not handled here */
+        break;
+    case AttributeObjectType::ControlUnitEnvironmentVariable:
+        nodeName = attributeRelation.nodeName;
+        environmentVariableName = attributeRelation.environmentVariableName;
+        break;
+    case AttributeObjectType::NodeTxMessage:
+        nodeName = attributeRelation.nodeName;
+        messageId = attributeRelation.messageId;
+        break;
+    case AttributeObjectType::NodeMappedRxSignal:
+        nodeName = attributeRelation.nodeName;
+        messageId = attributeRelation.messageId;
+        signalName = attributeRelation.signalName;
+        break;
+    }
+}
+
+bool operator<(const AttributeRelationKey & lhs, const AttributeRelationKey & rhs) {
+    return lessRelation(lhs, rhs);
+}
+
 }
 }
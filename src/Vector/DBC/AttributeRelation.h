@@ -56,7 +56,53 @@ struct VECTOR_DBC_EXPORT AttributeRelation : Attribute {
  * @param[in] rhs Right Hand Side of operation
  * @return comparison result
  */
-bool operator<(const AttributeRelation & lhs, const AttributeRelation & rhs);
+VECTOR_DBC_EXPORT bool operator<(const AttributeRelation & lhs, const AttributeRelation & rhs);
+
+/**
+ * Relation of an Attribute Value (BA_REL)
+ *
+ * Key of Network::attributeRelationValues: attribute name, relation type
+ * and the related objects of the relation type.
+ */
+struct VECTOR_DBC_EXPORT AttributeRelationKey {
+    AttributeRelationKey() = default;
+
+    /**
+     * @brief Relation of an attribute value
+     * @param[in] attributeRelation Attribute Value on Relation
+     *
+     * Only the fields of the relation type are taken over.
+     */
+    explicit AttributeRelationKey(const AttributeRelation & attributeRelation);
+
+    /** Attribute Name */
+    std::string name {};
+
+    /** Relation Type */
+    AttributeObjectType objectType { AttributeObjectType::Network };
+
+    /** Node Name */
+    std::string nodeName {};
+
+    /** Environment Variable Name */
+    std::string environmentVariableName {};
+
+    /** Message Identifier */
+    uint32_t messageId {};
+
+    /** Signal Name */
+    std::string signalName {};
+};
+
+/**
+ * Compare Operator
+ *
+ * @param[in] rhs Right Hand Side of operation
+ * @return comparison result
+ *
+ * Only the fields of the relation type are compared, as for AttributeRelation.
+ */
+VECTOR_DBC_EXPORT bool operator<(const AttributeRelationKey & lhs, const AttributeRelationKey & rhs);
 
 }
 }
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+#include <Vector/DBC/AttributeRelationIndex.h>
+
+namespace Vector {
+namespace DBC {
+
+/** combine two hashes */
+static uint64_t combine(uint64_t hash, uint64_t value) {
+    return (hash ^ value) * 0x100000001b3ULL;
+}
+
+std::size_t AttributeRelationIndex::hash(StringView name, AttributeObjectType objectType, StringView nodeName,
+                                         StringView environmentVariableName, uint32_t messageId, StringView signalName) {
+    uint64_t hash = combine(name.hash(), static_cast<uint64_t>(objectType));
+    switch (objectType) {
+    case AttributeObjectType::ControlUnitEnvironmentVariable:
+        hash = combine(hash, nodeName.hash());
+        hash = combine(hash, environmentVariableName.hash());
+        break;
+    case AttributeObjectType::NodeTxMessage:
+        hash = combine(hash, nodeName.hash());
+        hash = combine(hash, messageId);
+        break;
+    case AttributeObjectType::NodeMappedRxSignal:
+        hash = combine(hash, nodeName.hash());
+        hash = combine(hash, messageId);
+        hash = combine(hash, signalName.hash());
+        break;
+    default:
+        break;
+    }
+    return static_cast<std::size_t>(hash ^ (hash >> 32));
+}
+
+/**
+ * @brief Check if an attribute value on a relation matches
+ * @return true if the fields of the relation type are equal, as in operator<
+ */
+static bool matches(const AttributeRelation & attributeRelation, StringView name, AttributeObjectType objectType, StringView nodeName,
+                    StringView environmentVariableName, uint32_t messageId, StringView signalName) {
+    if ((attributeRelation.objectType != objectType) ||
+        (StringView(attributeRelation.name) != name))
+        return false;
+    switch (objectType) {
+    case AttributeObjectType::ControlUnitEnvironmentVariable:
+        return (StringView(attributeRelation.nodeName) == nodeName) &&
+               (StringView(attributeRelation.environmentVariableName) == environmentVariableName);
+    case AttributeObjectType::NodeTxMessage:
+        return (StringView(attributeRelation.nodeName) == nodeName) &&
+               (attributeRelation.messageId == messageId);
+    case AttributeObjectType::NodeMappedRxSignal:
+        return (StringView(attributeRelation.nodeName) == nodeName) &&
+               (attributeRelation.messageId == messageId) &&
+               (StringView(attributeRelation.signalName) == signalName);
+    default:
+        break;
+    }
+    return true;
+}
+
+AttributeRelationIndex::AttributeRelationIndex(const Network & network) {
+    for (const auto & attributeRelation : network.attributeRelationValues)
+        insert(attributeRelation.second);
+}
+
+void AttributeRelationIndex::insert(const AttributeRelation & attributeRelation) {
+    /* grow at half load */
+    if (2 * (slotCount + 1) > slots.size()) {
+        std::vector<const AttributeRelation *> oldSlots(slots.empty() ? 16 : 2 * slots.size(), nullptr);
+        oldSlots.swap(slots);
+        slotCount = 0;
+        for (const AttributeRelation * oldAttributeRelation : oldSlots) {
+            if (oldAttributeRelation != nullptr)
+                insert(*oldAttributeRelation);
+        }
+    }
+
+    const std::size_t mask = slots.size() - 1;
+    for (std::size_t slot = hash(attributeRelation.name, attributeRelation.objectType, attributeRelation.nodeName,
+                                 attributeRelation.environmentVariableName, attributeRelation.messageId, attributeRelation.signalName) & mask; ; slot = (slot + 1) & mask) {
+        if (slots[slot] == nullptr) {
+            slots[slot] = &attributeRelation;
+            ++slotCount;
+            return;
+        }
+        if (!(*slots[slot] < attributeRelation) && !(attributeRelation < *slots[slot])) {
+            slots[slot] = &attributeRelation;
+            return;
+        }
+    }
+}
+
+const AttributeRelation * AttributeRelationIndex::find(StringView name, AttributeObjectType objectType, StringView nodeName,
+                                                       StringView environmentVariableName, uint32_t messageId, StringView signalName) const {
+    if (slots.empty())
+        return nullptr;
+    const std::size_t mask = slots.size() - 1;
+    for (std::size_t slot = hash(name, objectType, nodeName, environmentVariableName, messageId, signalName) & mask; ; slot = (slot + 1) & mask) {
+        if (slots[slot] == nullptr)
+            return nullptr;
+        if (matches(*slots[slot], name, objectType, nodeName, environmentVariableName, messageId, signalName))
+            return slots[slot];
+    }
+}
+
+}
+}
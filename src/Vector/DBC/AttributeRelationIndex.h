@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <Vector/DBC/AttributeRelation.h>
+#include <Vector/DBC/Network.h>
+#include <Vector/DBC/StringView.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Attribute Relation Index
+ *
+ * Looks up attribute values on relations (BA_REL) by attribute name and
+ * related objects in a single hash probe, without allocating keys.
+ *
+ * The index refers to the values in Network::attributeRelationValues.
+ * Values can be edited in place, as long as their relation stays the
+ * same. Erasing a value, destroying the network or changing a relation
+ * invalidates the index, values added later are not indexed. In these
+ * cases the index has to be built again.
+ */
+struct VECTOR_DBC_EXPORT AttributeRelationIndex {
+    /** Hash table (open addressing, nullptr if unused, power of two size) */
+    std::vector<const AttributeRelation *> slots {};
+
+    /** Number of used slots */
+    uint32_t slotCount {};
+
+    AttributeRelationIndex() = default;
+
+    /**
+     * @brief Index the attribute values on relations of a network
+     * @param[in] network Network
+     */
+    explicit AttributeRelationIndex(const Network & network);
+
+    /**
+     * @brief Add or replace an attribute value on a relation
+     * @param[in] attributeRelation Attribute Value on Relation, kept by reference
+     */
+    void insert(const AttributeRelation & attributeRelation);
+
+    /**
+     * @brief Find the attribute value of a node and environment variable (BU_EV_REL)
+     * @param[in] name Attribute Name
+     * @param[in] nodeName Node Name
+     * @param[in] environmentVariableName Environment Variable Name
+     * @return Attribute Value on Relation or nullptr if not found
+     */
+    const AttributeRelation * findControlUnitEnvironmentVariable(StringView name, StringView nodeName, StringView environmentVariableName) const {
+        return find(name, AttributeObjectType::ControlUnitEnvironmentVariable, nodeName, environmentVariableName, 0, StringView(""));
+    }
+
+    /**
+     * @brief Find the attribute value of a node and transmitted message (BU_BO_REL)
+     * @param[in] name Attribute Name
+     * @param[in] nodeName Node Name
+     * @param[in] messageId Message Identifier
+     * @return Attribute Value on Relation or nullptr if not found
+     */
+    const AttributeRelation * findNodeTxMessage(StringView name, StringView nodeName, uint32_t messageId) const {
+        return find(name, AttributeObjectType::NodeTxMessage, nodeName, StringView(""), messageId, StringView(""));
+    }
+
+    /**
+     * @brief Find the attribute value of a node and mapped received signal (BU_SG_REL)
+     * @param[in] name Attribute Name
+     * @param[in] nodeName Node Name
+     * @param[in] messageId Message Identifier
+     * @param[in] signalName Signal Name
+     * @return Attribute Value on Relation or nullptr if not found
+     */
+    const AttributeRelation * findNodeMappedRxSignal(StringView name, StringView nodeName, uint32_t messageId, StringView signalName) const {
+        return find(name, AttributeObjectType::NodeMappedRxSignal, nodeName, StringView(""), messageId, signalName);
+    }
+
+    /**
+     * @brief Find an attribute value on a relation
+     * @param[in] name Attribute Name
+     * @param[in] objectType Relation Type
+     * @param[in] nodeName Node Name (relation types only)
+     * @param[in] environmentVariableName Environment Variable Name (BU_EV_REL only)
+     * @param[in] messageId Message Identifier (BU_BO_REL and BU_SG_REL only)
+     * @param[in] signalName Signal Name (BU_SG_REL only)
+     * @return Attribute Value on Relation or nullptr if not found
+     *
+     * Only the fields of the relation type are compared, as in operator<.
+     */
+    const AttributeRelation * find(StringView name, AttributeObjectType objectType, StringView nodeName,
+                                   StringView environmentVariableName, uint32_t messageId, StringView signalName) const;
+
+    /**
+     * @brief Hash of a relation
+     * @param[in] name Attribute Name
+     * @param[in] objectType Relation Type
+     * @param[in] nodeName Node Name (relation types only)
+     * @param[in] environmentVariableName Environment Variable Name (BU_EV_REL only)
+     * @param[in] messageId Message Identifier (BU_BO_REL and BU_SG_REL only)
+     * @param[in] signalName Signal Name (BU_SG_REL only)
+     * @return Hash
+     *
+     * Only the fields of the relation type are taken into account, as in operator<.
+     */
+    static std::size_t hash(StringView name, AttributeObjectType objectType, StringView nodeName,
+                            StringView environmentVariableName, uint32_t messageId, StringView signalName);
+};
+
+}
+}
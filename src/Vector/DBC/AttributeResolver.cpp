@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+#include <Vector/DBC/AttributeResolver.h>
+
+namespace Vector {
+namespace DBC {
+
+const uint32_t AttributeResolver::notFound;
+
+/**
+ * @brief Resolve an attribute value or default
+ * @param[in] attributeDefinition Attribute Definition
+ * @param[in] attribute Attribute Value or Default
+ * @param[in] isDefault Attribute is the default (BA_DEF_DEF stores enums by name)
+ * @return Resolved Value
+ */
+static AttributeResolver::Value resolveValue(const AttributeDefinition & attributeDefinition, const Attribute & attribute, bool isDefault) {
+    AttributeResolver::Value value;
+    value.type = attributeDefinition.valueType.type;
+    value.defined = true;
+    value.isDefault = isDefault;
+    const std::vector<std::string> & enumValues = attributeDefinition.valueType.enumValues;
+    switch (value.type) {
+    case AttributeValueType::Type::Int:
+        value.integerValue = attribute.integerValue;
+        value.floatValue = attribute.integerValue;
+        break;
+    case AttributeValueType::Type::Hex:
+        value.integerValue = attribute.hexValue;
+        value.floatValue = attribute.hexValue;
+        break;
+    case AttributeValueType::Type::Float:
+        value.integerValue = static_cast<int32_t>(std::lround(attribute.floatValue));
+        value.floatValue = attribute.floatValue;
+        break;
+    case AttributeValueType::Type::String:
+        value.stringValue = &attribute.stringValue;
+        break;
+    case AttributeValueType::Type::Enum:
+        if (isDefault) {
+            /* defaults refer to the enum by name */
+            auto enumValue = std::find(enumValues.cbegin(), enumValues.cend(), attribute.stringValue);
+            value.integerValue = (enumValue == enumValues.cend()) ? -1 : static_cast<int32_t>(enumValue - enumValues.cbegin());
+            value.stringValue = &attribute.stringValue;
+        } else {
+            value.integerValue = attribute.enumValue;
+            if ((value.integerValue >= 0) && (static_cast<std::size_t>(value.integerValue) < enumValues.size()))
+                value.stringValue = &enumValues[value.integerValue];
+        }
+        value.floatValue = value.integerValue;
+        break;
+    }
+    return value;
+}
+
+AttributeResolver::AttributeResolver(const Network & network) :
+    network(network) {
+    /* attribute ids */
+    for (const auto & attributeDefinition : network.attributeDefinitions) {
+        names.push_back(&attributeDefinition.first);
+        definitions.push_back(&attributeDefinition.second);
+        auto attributeDefault = network.attributeDefaults.find(attributeDefinition.first);
+        if (attributeDefault != network.attributeDefaults.cend())
+            defaults.push_back(resolveValue(attributeDefinition.second, attributeDefault->second, true));
+        else {
+            defaults.emplace_back();
+            defaults.back().type = attributeDefinition.second.valueType.type;
+        }
+    }
+    values.resize(definitions.size());
+
+    /* objects */
+    for (const auto & node : network.nodes)
+        nodes.push_back(&node.second);
+    for (const auto & message : network.messages) {
+        messageIds.insert(message.first, static_cast<uint32_t>(messages.size()));
+        messages.push_back(&message.second);
+        messageSignalBegin.push_back(static_cast<uint32_t>(signals.size()));
+        for (const auto & signal : message.second.signals)
+            signals.push_back(&signal.second);
+    }
+    messageSignalBegin.push_back(static_cast<uint32_t>(signals.size()));
+    for (const auto & environmentVariable : network.environmentVariables)
+        environmentVariables.push_back(&environmentVariable.second);
+}
+
+uint32_t AttributeResolver::attributeId(const std::string & name) const {
+    auto attributeDefinition = network.attributeDefinitions.find(name);
+    if (attributeDefinition == network.attributeDefinitions.cend())
+        return notFound;
+    return static_cast<uint32_t>(std::distance(network.attributeDefinitions.cbegin(), attributeDefinition));
+}
+
+uint32_t AttributeResolver::nodeIndex(const std::string & name) const {
+    auto node = network.nodes.find(name);
+    if (node == network.nodes.cend())
+        return notFound;
+    return static_cast<uint32_t>(std::distance(network.nodes.cbegin(), node));
+}
+
+uint32_t AttributeResolver::signalIndex(uint32_t messageId, const std::string & name) const {
+    uint32_t message = messageIds.find(messageId);
+    if (message == notFound)
+        return notFound;
+
+    /* signals of a message are ordered by their map key */
+    const std::map<std::string, Signal> & messageSignals = messages[message]->signals;
+    auto signal = messageSignals.find(name);
+    if (signal == messageSignals.cend())
+        return notFound;
+    return messageSignalBegin[message] + static_cast<uint32_t>(std::distance(messageSignals.cbegin(), signal));
+}
+
+uint32_t AttributeResolver::environmentVariableIndex(const std::string & name) const {
+    auto environmentVariable = network.environmentVariables.find(name);
+    if (environmentVariable == network.environmentVariables.cend())
+        return notFound;
+    return static_cast<uint32_t>(std::distance(network.environmentVariables.cbegin(), environmentVariable));
+}
+
+/**
+ * @brief Resolve the values of an attribute for a list of objects
+ * @param[in] name Attribute Name
+ * @param[in] attributeDefinition Attribute Definition
+ * @param[in] attributeDefault Resolved Attribute Default
+ * @param[in] objects Objects
+ * @param[out] values Resolved Values per object
+ */
+template<typename T>
+static void resolveValues(const std::string & name, const AttributeDefinition & attributeDefinition, const AttributeResolver::Value & attributeDefault,
+                          const std::vector<const T *> & objects, std::vector<AttributeResolver::Value> & values) {
+    values.reserve(objects.size());
+    for (const T * object : objects) {
+        auto attributeValue = object->attributeValues.find(name);
+        if (attributeValue == object->attributeValues.cend())
+            values.push_back(attributeDefault);
+        else
+            values.push_back(resolveValue(attributeDefinition, attributeValue->second, false));
+    }
+}
+
+void AttributeResolver::resolve(uint32_t attributeId) {
+    const std::string & name = *names[attributeId];
+    const AttributeDefinition & attributeDefinition = *definitions[attributeId];
+    const Value & attributeDefault = defaults[attributeId];
+    std::vector<Value> & attributeValues = values[attributeId];
+    switch (attributeDefinition.objectType) {
+    case AttributeObjectType::Network: {
+        auto attributeValue = network.attributeValues.find(name);
+        if (attributeValue == network.attributeValues.cend())
+            attributeValues.push_back(attributeDefault);
+        else
+            attributeValues.push_back(resolveValue(attributeDefinition, attributeValue->second, false));
+        break;
+    }
+    case AttributeObjectType::Node:
+        resolveValues(name, attributeDefinition, attributeDefault, nodes, attributeValues);
+        break;
+    case AttributeObjectType::Message:
+        resolveValues(name, attributeDefinition, attributeDefault, messages, attributeValues);
+        break;
+    case AttributeObjectType::Signal:
+        resolveValues(name, attributeDefinition, attributeDefault, signals, attributeValues);
+        break;
+    case AttributeObjectType::EnvironmentVariable:
+        resolveValues(name, attributeDefinition, attributeDefault, environmentVariables, attributeValues);
+        break;
+    default:
+        /* relations (BA_REL) have no object index */
+        break;
+    }
+}
+
+}
+}
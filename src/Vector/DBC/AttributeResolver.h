@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <Vector/DBC/AttributeValueType.h>
+#include <Vector/DBC/MessageIdIndex.h>
+#include <Vector/DBC/Network.h>
+#include <Vector/DBC/StringView.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Attribute Resolver
+ *
+ * Typed attribute values (BA) of the objects of a network with the
+ * attribute default (BA_DEF_DEF) already applied.
+ *
+ * Attribute names are mapped to ids once. Objects are referred to by
+ * their dense index per object type:
+ * - Network: 0
+ * - Node: position in Network::nodes
+ * - Message: position in Network::messages
+ * - Signal: position of the message's first signal plus position in Message::signals
+ * - Environment Variable: position in Network::environmentVariables
+ *
+ * The values of an attribute are resolved for all its objects on the
+ * first query, so later queries are a vector access.
+ * The network must outlive the resolver, create a new one after changing it.
+ *
+ * @note Queries resolve values, so they must not be called concurrently.
+ */
+struct VECTOR_DBC_EXPORT AttributeResolver {
+    /** Id of unknown attributes and index of unknown objects */
+    static const uint32_t notFound = 0xffffffff;
+
+    /** Resolved Attribute Value */
+    struct Value {
+        /** Value Type */
+        AttributeValueType::Type type { AttributeValueType::Type::Int };
+
+        /** Attribute has a value or a default */
+        bool defined { false };
+
+        /** Value is the attribute default */
+        bool isDefault { false };
+
+        /** Integer Value of Int/Hex, index of Enum or -1 for unknown names (converted from Float) */
+        int32_t integerValue {};
+
+        /** Float Value of Float (converted from Int/Hex/Enum) */
+        double floatValue {};
+
+        /** String Value of String, name of Enum (nullptr if undefined or out of range) */
+        const std::string * stringValue { nullptr };
+    };
+
+    /**
+     * @brief Constructor
+     * @param[in] network Network
+     */
+    explicit AttributeResolver(const Network & network);
+
+    /** Network */
+    const Network & network;
+
+    /** Attribute Names per id, in order of Network::attributeDefinitions */
+    std::vector<const std::string *> names {};
+
+    /** Attribute Definitions per id */
+    std::vector<const AttributeDefinition *> definitions {};
+
+    /** Resolved Attribute Default per id */
+    std::vector<Value> defaults {};
+
+    /** Resolved Values per id and object index (empty until the first query) */
+    std::vector<std::vector<Value>> values {};
+
+    /** Nodes */
+    std::vector<const Node *> nodes {};
+
+    /** Messages */
+    std::vector<const Message *> messages {};
+
+    /** Message index per identifier */
+    MessageIdIndex messageIds {};
+
+    /** Index of the first signal per message (one more entry than messages) */
+    std::vector<uint32_t> messageSignalBegin {};
+
+    /** Signals */
+    std::vector<const Signal *> signals {};
+
+    /** Environment Variables */
+    std::vector<const EnvironmentVariable *> environmentVariables {};
+
+    /**
+     * @brief Attribute id of a name
+     * @param[in] name Attribute Name
+     * @return Attribute id or notFound
+     */
+    uint32_t attributeId(const std::string & name) const;
+
+    /**
+     * @brief Index of a node
+     * @param[in] name Node Name
+     * @return Object index or notFound
+     */
+    uint32_t nodeIndex(const std::string & name) const;
+
+    /**
+     * @brief Index of a message
+     * @param[in] id Message Identifier
+     * @return Object index or notFound
+     */
+    uint32_t messageIndex(uint32_t id) const {
+        return messageIds.find(id);
+    }
+
+    /**
+     * @brief Index of a signal
+     * @param[in] messageId Message Identifier
+     * @param[in] name Signal Name
+     * @return Object index or notFound
+     */
+    uint32_t signalIndex(uint32_t messageId, const std::string & name) const;
+
+    /**
+     * @brief Index of an environment variable
+     * @param[in] name Environment Variable Name
+     * @return Object index or notFound
+     */
+    uint32_t environmentVariableIndex(const std::string & name) const;
+
+    /**
+     * @brief Resolved value of an attribute
+     * @param[in] attributeId Attribute id
+     * @param[in] objectIndex Object index of the attribute's object type
+     * @return Value, or the resolved default for objects of other types
+     */
+    const Value & value(uint32_t attributeId, uint32_t objectIndex) {
+        static const Value undefined;
+        if (attributeId >= definitions.size())
+            return undefined;
+        if (values[attributeId].empty())
+            resolve(attributeId);
+        if (objectIndex >= values[attributeId].size())
+            return defaults[attributeId];
+        return values[attributeId][objectIndex];
+    }
+
+    /**
+     * @brief Integer value of an attribute
+     * @param[in] attributeId Attribute id
+     * @param[in] objectIndex Object index
+     * @return Value (0 if undefined)
+     */
+    int32_t integerValue(uint32_t attributeId, uint32_t objectIndex) {
+        return value(attributeId, objectIndex).integerValue;
+    }
+
+    /**
+     * @brief Float value of an attribute
+     * @param[in] attributeId Attribute id
+     * @param[in] objectIndex Object index
+     * @return Value (0 if undefined)
+     */
+    double floatValue(uint32_t attributeId, uint32_t objectIndex) {
+        return value(attributeId, objectIndex).floatValue;
+    }
+
+    /**
+     * @brief String value of an attribute
+     * @param[in] attributeId Attribute id
+     * @param[in] objectIndex Object index
+     * @return String or enum name (data == nullptr if undefined)
+     */
+    StringView stringValue(uint32_t attributeId, uint32_t objectIndex) {
+        const std::string * stringValue = value(attributeId, objectIndex).stringValue;
+        if (stringValue == nullptr)
+            return StringView();
+        return StringView(*stringValue);
+    }
+
+    /**
+     * @brief Resolve the values of an attribute for all its objects
+     * @param[in] attributeId Attribute id
+     */
+    void resolve(uint32_t attributeId);
+};
+
+}
+}
@@ -0,0 +1,293 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <utility>
+
+#include <Vector/DBC/AttributeTable.h>
+
+namespace Vector {
+namespace DBC {
+
+const uint32_t AttributeTable::notFound;
+
+/** number of object types with an object index */
+static const std::size_t objectTypeCount = 5;
+
+/** attribute value maps per object type in object index order */
+typedef std::vector<std::map<std::string, Attribute> *> AttributeMaps[objectTypeCount];
+
+/**
+ * @brief Collect the attribute value maps of all objects
+ * @param[in] network Network
+ * @param[out] attributeMaps Attribute value maps per object type
+ */
+static void collectAttributeMaps(Network & network, AttributeMaps & attributeMaps) {
+    attributeMaps[static_cast<std::size_t>(AttributeObjectType::Network)].push_back(&network.attributeValues);
+    for (auto & node : network.nodes)
+        attributeMaps[static_cast<std::size_t>(AttributeObjectType::Node)].push_back(&node.second.attributeValues);
+    for (auto & message : network.messages) {
+        attributeMaps[static_cast<std::size_t>(AttributeObjectType::Message)].push_back(&message.second.attributeValues);
+        for (auto & signal : message.second.signals)
+            attributeMaps[static_cast<std::size_t>(AttributeObjectType::Signal)].push_back(&signal.second.attributeValues);
+    }
+    for (auto & environmentVariable : network.environmentVariables)
+        attributeMaps[static_cast<std::size_t>(AttributeObjectType::EnvironmentVariable)].push_back(&environmentVariable.second.attributeValues);
+}
+
+uint32_t AttributeTable::Column::findRow(uint32_t objectIndex) const {
+    auto object = std::lower_bound(objects.cbegin(), objects.cend(), objectIndex);
+    if ((object == objects.cend()) || (*object != objectIndex))
+        return notFound;
+    return static_cast<uint32_t>(object - objects.cbegin());
+}
+
+/**
+ * @brief Create a column
+ * @param[in] network Network
+ * @param[in] attributeDefinition Attribute Definition
+ * @param[in] name Attribute Name
+ * @param[in] objectType Object Type
+ * @param[inout] strings String Values
+ * @return Column
+ */
+static AttributeTable::Column createColumn(const Network & network, const AttributeDefinition & attributeDefinition,
+                                           const std::string & name, AttributeObjectType objectType, SymbolTable & strings) {
+    AttributeTable::Column column;
+    column.name = name;
+    column.objectType = objectType;
+    column.valueType = attributeDefinition.valueType.type;
+    column.enumValues = attributeDefinition.valueType.enumValues;
+
+    /* default */
+    auto attributeDefault = network.attributeDefaults.find(name);
+    if (attributeDefault == network.attributeDefaults.cend())
+        return column;
+    column.hasDefault = true;
+    switch (column.valueType) {
+    case AttributeValueType::Type::Int:
+        column.integerDefault = attributeDefault->second.integerValue;
+        break;
+    case AttributeValueType::Type::Hex:
+        column.integerDefault = attributeDefault->second.hexValue;
+        break;
+    case AttributeValueType::Type::Float:
+        column.floatDefault = attributeDefault->second.floatValue;
+        break;
+    case AttributeValueType::Type::String:
+        column.stringDefault = strings.insert(attributeDefault->second.stringValue);
+        break;
+    case AttributeValueType::Type::Enum: {
+        /* defaults refer to the enum by name */
+        auto enumValue = std::find(column.enumValues.cbegin(), column.enumValues.cend(), attributeDefault->second.stringValue);
+        column.integerDefault = (enumValue == column.enumValues.cend()) ? -1 : static_cast<int32_t>(enumValue - column.enumValues.cbegin());
+        break;
+    }
+    }
+    return column;
+}
+
+void AttributeTable::extract(Network & network) {
+    AttributeMaps attributeMaps;
+    collectAttributeMaps(network, attributeMaps);
+    for (std::size_t objectType = 0; objectType < objectTypeCount; ++objectType)
+        objectCounts[objectType] = static_cast<uint32_t>(attributeMaps[objectType].size());
+
+    /* a column per definition of an object attribute */
+    std::map<std::pair<std::string, AttributeObjectType>, uint32_t> columnIndex;
+    for (const Column & column : columns)
+        columnIndex[std::make_pair(column.name, column.objectType)] = static_cast<uint32_t>(&column - columns.data());
+    for (const auto & attributeDefinition : network.attributeDefinitions) {
+        if (static_cast<std::size_t>(attributeDefinition.second.objectType) >= objectTypeCount)
+            continue;
+        auto key = std::make_pair(attributeDefinition.first, attributeDefinition.second.objectType);
+        if (columnIndex.count(key))
+            continue;
+        columnIndex[key] = static_cast<uint32_t>(columns.size());
+        columns.push_back(createColumn(network, attributeDefinition.second, attributeDefinition.first, attributeDefinition.second.objectType, strings));
+    }
+
+    /* move the values in object order, so that the object indices are ascending */
+    for (std::size_t objectType = 0; objectType < objectTypeCount; ++objectType) {
+        for (uint32_t objectIndex = 0; objectIndex < objectCounts[objectType]; ++objectIndex) {
+            std::map<std::string, Attribute> & attributeValues = *attributeMaps[objectType][objectIndex];
+            for (auto attributeValue = attributeValues.begin(); attributeValue != attributeValues.end(); ) {
+                /* values without definition (or a differing name) are kept */
+                auto attributeDefinition = network.attributeDefinitions.find(attributeValue->first);
+                if ((attributeDefinition == network.attributeDefinitions.cend()) || (attributeValue->second.name != attributeValue->first)) {
+                    ++attributeValue;
+                    continue;
+                }
+
+                /* column, also for values on objects of another type than defined */
+                auto key = std::make_pair(attributeValue->first, static_cast<AttributeObjectType>(objectType));
+                auto column = columnIndex.find(key);
+                if (column == columnIndex.end()) {
+                    column = columnIndex.insert(std::make_pair(key, static_cast<uint32_t>(columns.size()))).first;
+                    columns.push_back(createColumn(network, attributeDefinition->second, key.first, key.second, strings));
+                }
+
+                /* row */
+                Column & attributeColumn = columns[column->second];
+                attributeColumn.objects.push_back(objectIndex);
+                switch (attributeColumn.valueType) {
+                case AttributeValueType::Type::Int:
+                    attributeColumn.integerValues.push_back(attributeValue->second.integerValue);
+                    break;
+                case AttributeValueType::Type::Hex:
+                    attributeColumn.integerValues.push_back(attributeValue->second.hexValue);
+                    break;
+                case AttributeValueType::Type::Float:
+                    attributeColumn.floatValues.push_back(attributeValue->second.floatValue);
+                    break;
+                case AttributeValueType::Type::String:
+                    attributeColumn.stringValues.push_back(strings.insert(attributeValue->second.stringValue));
+                    break;
+                case AttributeValueType::Type::Enum:
+                    attributeColumn.integerValues.push_back(attributeValue->second.enumValue);
+                    break;
+                }
+                attributeValue = attributeValues.erase(attributeValue);
+            }
+        }
+    }
+}
+
+void AttributeTable::restore(Network & network) {
+    AttributeMaps attributeMaps;
+    collectAttributeMaps(network, attributeMaps);
+
+    for (Column & column : columns) {
+        const std::size_t objectType = static_cast<std::size_t>(column.objectType);
+        for (std::size_t row = 0; row < column.objects.size(); ++row) {
+            if (column.objects[row] >= attributeMaps[objectType].size())
+                continue;
+            Attribute & attribute = (*attributeMaps[objectType][column.objects[row]])[column.name];
+            attribute.name = column.name;
+            attribute.objectType = column.objectType;
+            switch (column.valueType) {
+            case AttributeValueType::Type::Int:
+                attribute.integerValue = column.integerValues[row];
+                break;
+            case AttributeValueType::Type::Hex:
+                attribute.hexValue = column.integerValues[row];
+                break;
+            case AttributeValueType::Type::Float:
+                attribute.floatValue = column.floatValues[row];
+                break;
+            case AttributeValueType::Type::String:
+                attribute.stringValue = strings.string(column.stringValues[row]).toString();
+                break;
+            case AttributeValueType::Type::Enum:
+                attribute.enumValue = column.integerValues[row];
+                break;
+            }
+        }
+    }
+
+    /* the table is empty afterwards */
+    columns.clear();
+    strings = SymbolTable();
+    std::fill(std::begin(objectCounts), std::end(objectCounts), 0);
+}
+
+uint32_t AttributeTable::findColumn(const std::string & name, AttributeObjectType objectType) const {
+    for (const Column & column : columns) {
+        if ((column.name == name) && (column.objectType == objectType))
+            return static_cast<uint32_t>(&column - columns.data());
+    }
+    return notFound;
+}
+
+/**
+ * @brief Select the objects of a column, whose values match
+ * @param[in] column Column
+ * @param[in] objectCount Number of objects of the column's object type
+ * @param[in] defaultMatches Objects without value match
+ * @param[in] matches Row matches
+ * @return Object indices (ascending)
+ */
+template<typename Matches>
+static std::vector<uint32_t> selectRows(const AttributeTable::Column & column, uint32_t objectCount, bool defaultMatches, Matches matches) {
+    std::vector<uint32_t> objects;
+    if (!defaultMatches) {
+        for (std::size_t row = 0; row < column.objects.size(); ++row) {
+            if (matches(row))
+                objects.push_back(column.objects[row]);
+        }
+        return objects;
+    }
+
+    /* merge the objects without value */
+    std::size_t row = 0;
+    for (uint32_t objectIndex = 0; objectIndex < objectCount; ++objectIndex) {
+        if ((row < column.objects.size()) && (column.objects[row] == objectIndex)) {
+            if (matches(row))
+                objects.push_back(objectIndex);
+            ++row;
+        } else
+            objects.push_back(objectIndex);
+    }
+    return objects;
+}
+
+std::vector<uint32_t> AttributeTable::select(uint32_t column, int32_t integerValue) const {
+    if (column >= columns.size())
+        return std::vector<uint32_t>();
+    const Column & attributeColumn = columns[column];
+    if ((attributeColumn.valueType == AttributeValueType::Type::Float) ||
+        (attributeColumn.valueType == AttributeValueType::Type::String))
+        return std::vector<uint32_t>();
+    bool defaultMatches = attributeColumn.hasDefault && (attributeColumn.integerDefault == integerValue);
+    return selectRows(attributeColumn, objectCounts[static_cast<std::size_t>(attributeColumn.objectType)], defaultMatches,
+    [&attributeColumn, integerValue](std::size_t row) {
+        return attributeColumn.integerValues[row] == integerValue;
+    });
+}
+
+std::vector<uint32_t> AttributeTable::select(uint32_t column, StringView stringValue) const {
+    if (column >= columns.size())
+        return std::vector<uint32_t>();
+    const Column & attributeColumn = columns[column];
+
+    /* enums are selected by index */
+    if (attributeColumn.valueType == AttributeValueType::Type::Enum) {
+        for (std::size_t enumValue = 0; enumValue < attributeColumn.enumValues.size(); ++enumValue) {
+            if (StringView(attributeColumn.enumValues[enumValue]) == stringValue)
+                return select(column, static_cast<int32_t>(enumValue));
+        }
+        return std::vector<uint32_t>();
+    }
+    if (attributeColumn.valueType != AttributeValueType::Type::String)
+        return std::vector<uint32_t>();
+
+    /* strings are compared by symbol id */
+    uint32_t id = strings.find(stringValue);
+    bool defaultMatches = attributeColumn.hasDefault && (id != SymbolTable::notFound) && (attributeColumn.stringDefault == id);
+    return selectRows(attributeColumn, objectCounts[static_cast<std::size_t>(attributeColumn.objectType)], defaultMatches,
+    [&attributeColumn, id](std::size_t row) {
+        return attributeColumn.stringValues[row] == id;
+    });
+}
+
+}
+}
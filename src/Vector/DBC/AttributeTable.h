@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <Vector/DBC/AttributeObjectType.h>
+#include <Vector/DBC/AttributeValueType.h>
+#include <Vector/DBC/Network.h>
+#include <Vector/DBC/StringView.h>
+#include <Vector/DBC/SymbolTable.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Attribute Table
+ *
+ * Columnar storage of the attribute values (BA) of network, nodes,
+ * messages, signals and environment variables. There is one column per
+ * attribute definition and object type, holding the indices of the
+ * objects with a value and the values typed by the definition's value
+ * type. String values are interned.
+ *
+ * Objects are referred to by their dense index per object type, as in
+ * AttributeResolver.
+ *
+ * extract moves the values out of the objects' attributeValues maps and
+ * restore moves them back, so the network is written identically.
+ * Attribute values on relations (BA_REL) are not part of the table.
+ */
+struct VECTOR_DBC_EXPORT AttributeTable {
+    /** Index of unknown columns and rows */
+    static const uint32_t notFound = 0xffffffff;
+
+    /** Column */
+    struct Column {
+        /** Attribute Name */
+        std::string name {};
+
+        /** Object Type */
+        AttributeObjectType objectType { AttributeObjectType::Network };
+
+        /** Value Type */
+        AttributeValueType::Type valueType { AttributeValueType::Type::Int };
+
+        /** Object indices with a value (ascending) */
+        std::vector<uint32_t> objects {};
+
+        /** Values of Int, Hex and Enum (index) per row */
+        std::vector<int32_t> integerValues {};
+
+        /** Values of Float per row */
+        std::vector<double> floatValues {};
+
+        /** Values of String per row (symbol ids) */
+        std::vector<uint32_t> stringValues {};
+
+        /** Attribute has a default (BA_DEF_DEF) */
+        bool hasDefault { false };
+
+        /** Default of Int, Hex and Enum (index, -1 if unknown) */
+        int32_t integerDefault {};
+
+        /** Default of Float */
+        double floatDefault {};
+
+        /** Default of String (symbol id) */
+        uint32_t stringDefault { SymbolTable::notFound };
+
+        /** Enum Values */
+        std::vector<std::string> enumValues {};
+
+        /**
+         * @brief Find the row of an object
+         * @param[in] objectIndex Object index
+         * @return Row or notFound if the object has no value
+         */
+        uint32_t findRow(uint32_t objectIndex) const;
+    };
+
+    /** Columns */
+    std::vector<Column> columns {};
+
+    /** String Values */
+    SymbolTable strings {};
+
+    /** Number of objects per object type (Network, Node, Message, Signal, Environment Variable) */
+    uint32_t objectCounts[5] {};
+
+    /**
+     * @brief Move the attribute values of all objects into the table
+     * @param[inout] network Network
+     *
+     * Values of attributes without definition stay in the objects.
+     * The network must not change objects until restore.
+     */
+    void extract(Network & network);
+
+    /**
+     * @brief Move the attribute values back into the objects
+     * @param[inout] network Network with the objects of extract
+     *
+     * The table is empty afterwards.
+     */
+    void restore(Network & network);
+
+    /**
+     * @brief Find a column
+     * @param[in] name Attribute Name
+     * @param[in] objectType Object Type
+     * @return Column index or notFound
+     */
+    uint32_t findColumn(const std::string & name, AttributeObjectType objectType) const;
+
+    /**
+     * @brief Select the objects with an Int, Hex or Enum value
+     * @param[in] column Column index
+     * @param[in] integerValue Value (index for Enum)
+     * @return Object indices (ascending), including objects with a matching default
+     */
+    std::vector<uint32_t> select(uint32_t column, int32_t integerValue) const;
+
+    /**
+     * @brief Select the objects with a String or Enum value
+     * @param[in] column Column index
+     * @param[in] stringValue Value (name for Enum)
+     * @return Object indices (ascending), including objects with a matching default
+     */
+    std::vector<uint32_t> select(uint32_t column, StringView stringValue) const;
+};
+
+}
+}
@@ -0,0 +1,328 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <cstring>
+
+#include <Vector/DBC/BatchDecoder.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define VECTOR_DBC_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+namespace Vector {
+namespace DBC {
+
+/** Window parameters shared by all frames of a batch */
+struct BatchWindow {
+    /** First byte of the window */
+    std::size_t origin;
+
+    /** Position of the LSB within the window */
+    unsigned int shift;
+
+    /** Mask of the raw value bits */
+    uint64_t mask;
+
+    /** Sign bit (0 if unsigned or 64 bits wide), sign extends with (v ^ sign) - sign */
+    uint64_t sign;
+};
+
+#if VECTOR_DBC_X86_DISPATCH
+
+static inline uint64_t load64(const uint8_t * p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+/* 2^52 and 2^52 + 2^51 for exact int64 to double conversion of values below 52 bits */
+static const uint64_t magicBits = 0x4330000000000000ULL;
+static const double magicUnsigned = 4503599627370496.0;
+static const double magicSigned = 6755399441055744.0;
+static const uint64_t signedBias = 0x0008000000000000ULL;
+
+template<bool byteSwap>
+__attribute__((target("avx2")))
+static inline __m256i extractAvx2(const uint8_t * p, std::size_t stride, const BatchWindow & window) {
+    __m256i v = _mm256_set_epi64x(
+                    static_cast<int64_t>(load64(p + 3 * stride)),
+                    static_cast<int64_t>(load64(p + 2 * stride)),
+                    static_cast<int64_t>(load64(p + stride)),
+                    static_cast<int64_t>(load64(p)));
+    if (byteSwap) {
+        const __m256i swap = _mm256_setr_epi8(
+                                 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+        v = _mm256_shuffle_epi8(v, swap);
+    }
+    v = _mm256_srl_epi64(v, _mm_cvtsi32_si128(static_cast<int>(window.shift)));
+    v = _mm256_and_si256(v, _mm256_set1_epi64x(static_cast<int64_t>(window.mask)));
+    const __m256i sign = _mm256_set1_epi64x(static_cast<int64_t>(window.sign));
+    return _mm256_sub_epi64(_mm256_xor_si256(v, sign), sign);
+}
+
+template<bool byteSwap>
+__attribute__((target("avx2")))
+static std::size_t decodeAvx2(const uint8_t * frames, std::size_t count, std::size_t stride, const BatchWindow & window, uint64_t * column) {
+    const uint8_t * p = frames + window.origin;
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4, p += 4 * stride)
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(column + i), extractAvx2<byteSwap>(p, stride, window));
+    return i;
+}
+
+template<SignalConversion::RawType rawType>
+__attribute__((target("avx2")))
+static inline __m256d toDoubleAvx2(__m256i v) {
+    switch (rawType) {
+    case SignalConversion::RawType::Unsigned:
+        v = _mm256_or_si256(v, _mm256_set1_epi64x(static_cast<int64_t>(magicBits)));
+        return _mm256_sub_pd(_mm256_castsi256_pd(v), _mm256_set1_pd(magicUnsigned));
+    case SignalConversion::RawType::Signed:
+        v = _mm256_add_epi64(v, _mm256_set1_epi64x(static_cast<int64_t>(signedBias)));
+        v = _mm256_or_si256(v, _mm256_set1_epi64x(static_cast<int64_t>(magicBits)));
+        return _mm256_sub_pd(_mm256_castsi256_pd(v), _mm256_set1_pd(magicSigned));
+    case SignalConversion::RawType::Float:
+        /* gather the lower 32 bits of each lane */
+        v = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6));
+        return _mm256_cvtps_pd(_mm_castsi128_ps(_mm256_castsi256_si128(v)));
+    case SignalConversion::RawType::Double:
+        break;
+    }
+    return _mm256_castsi256_pd(v);
+}
+
+template<bool byteSwap, SignalConversion::RawType rawType>
+__attribute__((target("avx2")))
+static std::size_t decodeAvx2(const uint8_t * frames, std::size_t count, std::size_t stride, const BatchWindow & window, const SignalConversion & conversion, double * column) {
+    const __m256d factor = _mm256_set1_pd(conversion.factor);
+    const __m256d offset = _mm256_set1_pd(conversion.offset);
+    const uint8_t * p = frames + window.origin;
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4, p += 4 * stride) {
+        __m256d d = toDoubleAvx2<rawType>(extractAvx2<byteSwap>(p, stride, window));
+        _mm256_storeu_pd(column + i, _mm256_add_pd(_mm256_mul_pd(d, factor), offset));
+    }
+    return i;
+}
+
+template<bool byteSwap>
+__attribute__((target("sse4.2")))
+static inline __m128i extractSse42(const uint8_t * p, std::size_t stride, const BatchWindow & window) {
+    __m128i v = _mm_set_epi64x(
+                    static_cast<int64_t>(load64(p + stride)),
+                    static_cast<int64_t>(load64(p)));
+    if (byteSwap) {
+        const __m128i swap = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+        v = _mm_shuffle_epi8(v, swap);
+    }
+    v = _mm_srl_epi64(v, _mm_cvtsi32_si128(static_cast<int>(window.shift)));
+    v = _mm_and_si128(v, _mm_set1_epi64x(static_cast<int64_t>(window.mask)));
+    const __m128i sign = _mm_set1_epi64x(static_cast<int64_t>(window.sign));
+    return _mm_sub_epi64(_mm_xor_si128(v, sign), sign);
+}
+
+template<bool byteSwap>
+__attribute__((target("sse4.2")))
+static std::size_t decodeSse42(const uint8_t * frames, std::size_t count, std::size_t stride, const BatchWindow & window, uint64_t * column) {
+    const uint8_t * p = frames + window.origin;
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2, p += 2 * stride)
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(column + i), extractSse42<byteSwap>(p, stride, window));
+    return i;
+}
+
+template<SignalConversion::RawType rawType>
+__attribute__((target("sse4.2")))
+static inline __m128d toDoubleSse42(__m128i v) {
+    switch (rawType) {
+    case SignalConversion::RawType::Unsigned:
+        v = _mm_or_si128(v, _mm_set1_epi64x(static_cast<int64_t>(magicBits)));
+        return _mm_sub_pd(_mm_castsi128_pd(v), _mm_set1_pd(magicUnsigned));
+    case SignalConversion::RawType::Signed:
+        v = _mm_add_epi64(v, _mm_set1_epi64x(static_cast<int64_t>(signedBias)));
+        v = _mm_or_si128(v, _mm_set1_epi64x(static_cast<int64_t>(magicBits)));
+        return _mm_sub_pd(_mm_castsi128_pd(v), _mm_set1_pd(magicSigned));
+    case SignalConversion::RawType::Float:
+        /* gather the lower 32 bits of each lane */
+        v = _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 0, 2, 0));
+        return _mm_cvtps_pd(_mm_castsi128_ps(v));
+    case SignalConversion::RawType::Double:
+        break;
+    }
+    return _mm_castsi128_pd(v);
+}
+
+template<bool byteSwap, SignalConversion::RawType rawType>
+__attribute__((target("sse4.2")))
+static std::size_t decodeSse42(const uint8_t * frames, std::size_t count, std::size_t stride, const BatchWindow & window, const SignalConversion & conversion, double * column) {
+    const __m128d factor = _mm_set1_pd(conversion.factor);
+    const __m128d offset = _mm_set1_pd(conversion.offset);
+    const uint8_t * p = frames + window.origin;
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2, p += 2 * stride) {
+        __m128d d = toDoubleSse42<rawType>(extractSse42<byteSwap>(p, stride, window));
+        _mm_storeu_pd(column + i, _mm_add_pd(_mm_mul_pd(d, factor), offset));
+    }
+    return i;
+}
+
+/** physical value kernel */
+using PhysicalKernel = std::size_t (*)(const uint8_t * frames, std::size_t count, std::size_t stride, const BatchWindow & window, const SignalConversion & conversion, double * column);
+
+template<bool byteSwap>
+static PhysicalKernel physicalKernel(bool avx2, SignalConversion::RawType rawType) {
+    switch (rawType) {
+    case SignalConversion::RawType::Unsigned:
+        return avx2 ?
+               &decodeAvx2<byteSwap, SignalConversion::RawType::Unsigned> :
+               &decodeSse42<byteSwap, SignalConversion::RawType::Unsigned>;
+    case SignalConversion::RawType::Signed:
+        return avx2 ?
+               &decodeAvx2<byteSwap, SignalConversion::RawType::Signed> :
+               &decodeSse42<byteSwap, SignalConversion::RawType::Signed>;
+    case SignalConversion::RawType::Float:
+        return avx2 ?
+               &decodeAvx2<byteSwap, SignalConversion::RawType::Float> :
+               &decodeSse42<byteSwap, SignalConversion::RawType::Float>;
+    case SignalConversion::RawType::Double:
+        break;
+    }
+    return avx2 ?
+           &decodeAvx2<byteSwap, SignalConversion::RawType::Double> :
+           &decodeSse42<byteSwap, SignalConversion::RawType::Double>;
+}
+
+/** Instruction Set Extension */
+enum class Isa {
+    /** no vectorization */
+    Scalar,
+
+    /** SSE4.2 (2 lanes) */
+    Sse42,
+
+    /** AVX2 (4 lanes) */
+    Avx2
+};
+
+static Isa detectIsa() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return Isa::Avx2;
+    if (__builtin_cpu_supports("sse4.2"))
+        return Isa::Sse42;
+    return Isa::Scalar;
+}
+
+static Isa isa() {
+    static const Isa detected = detectIsa();
+    return detected;
+}
+
+#endif
+
+/**
+ * @brief Prepare the window used for all frames of a batch
+ * @return false if the signal needs the scalar path
+ */
+static bool batchWindow(const SignalLayout & layout, std::size_t size, BatchWindow & window) {
+    if (!layout.window(size, window.origin, window.shift))
+        return false;
+    window.mask = layout.mask;
+    window.sign = (layout.signExtension >> 1) & layout.mask;
+    return true;
+}
+
+void decodeBatch(const SignalLayout & layout, const uint8_t * frames, std::size_t count, std::size_t stride, std::size_t size, uint64_t * column) {
+    std::size_t i = 0;
+
+#if VECTOR_DBC_X86_DISPATCH
+    BatchWindow window;
+    if (batchWindow(layout, size, window)) {
+        switch (isa()) {
+        case Isa::Avx2:
+            i = layout.byteSwap ?
+                decodeAvx2<true>(frames, count, stride, window, column) :
+                decodeAvx2<false>(frames, count, stride, window, column);
+            break;
+        case Isa::Sse42:
+            i = layout.byteSwap ?
+                decodeSse42<true>(frames, count, stride, window, column) :
+                decodeSse42<false>(frames, count, stride, window, column);
+            break;
+        case Isa::Scalar:
+            break;
+        }
+    }
+#endif
+
+    /* scalar fallback and remaining frames */
+    for (; i < count; ++i)
+        column[i] = layout.decode(frames + i * stride, size);
+}
+
+void decodeBatch(const SignalLayout & layout, const SignalConversion & conversion, const uint8_t * frames, std::size_t count, std::size_t stride, std::size_t size, double * column) {
+    std::size_t i = 0;
+
+#if VECTOR_DBC_X86_DISPATCH
+    /* exact vectorized int64 to double conversion is limited to 52 bits */
+    bool integer = (conversion.rawType == SignalConversion::RawType::Unsigned) || (conversion.rawType == SignalConversion::RawType::Signed);
+    BatchWindow window;
+    if ((isa() != Isa::Scalar) && (!integer || (layout.mask >> 52 == 0)) && batchWindow(layout, size, window)) {
+        bool avx2 = (isa() == Isa::Avx2);
+        PhysicalKernel kernel = layout.byteSwap ?
+                                physicalKernel<true>(avx2, conversion.rawType) :
+                                physicalKernel<false>(avx2, conversion.rawType);
+        i = kernel(frames, count, stride, window, conversion, column);
+    }
+#endif
+
+    /* scalar fallback and remaining frames */
+    for (; i < count; ++i)
+        column[i] = conversion.physicalValue(layout.decode(frames + i * stride, size));
+}
+
+BatchDecoder::BatchDecoder(const Message & message) {
+    layouts.reserve(message.signals.size());
+    conversions.reserve(message.signals.size());
+    for (const auto & signal : message.signals) {
+        layouts.push_back(signal.second.layout());
+        conversions.push_back(signal.second.conversion());
+    }
+}
+
+void BatchDecoder::decode(const uint8_t * frames, std::size_t count, std::size_t stride, std::size_t size, uint64_t * const * columns) const {
+    for (std::size_t s = 0; s < layouts.size(); ++s) {
+        if (columns[s])
+            decodeBatch(layouts[s], frames, count, stride, size, columns[s]);
+    }
+}
+
+void BatchDecoder::decodePhysical(const uint8_t * frames, std::size_t count, std::size_t stride, std::size_t size, double * const * columns) const {
+    for (std::size_t s = 0; s < layouts.size(); ++s) {
+        if (columns[s])
+            decodeBatch(layouts[s], conversions[s], frames, count, stride, size, columns[s]);
+    }
+}
+
+}
+}
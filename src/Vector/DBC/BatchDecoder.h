@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Vector/DBC/Message.h>
+#include <Vector/DBC/SignalConversion.h>
+#include <Vector/DBC/SignalLayout.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * @brief Decodes a signal out of N frames into a column
+ * @param[in] layout Signal Layout
+ * @param[in] frames First frame
+ * @param[in] count Number of frames
+ * @param[in] stride Distance between frames in bytes (equals size for packed frames)
+ * @param[in] size Size of each frame in bytes
+ * @param[out] column Raw values (count entries)
+ *
+ * The kernel is vectorized (AVX2, SSE4.2) if supported by the CPU.
+ */
+VECTOR_DBC_EXPORT void decodeBatch(const SignalLayout & layout, const uint8_t * frames, std::size_t count, std::size_t stride, std::size_t size, uint64_t * column);
+
+/**
+ * @brief Decodes a signal out of N frames into a column of physical values
+ * @param[in] layout Signal Layout
+ * @param[in] conversion Signal Conversion
+ * @param[in] frames First frame
+ * @param[in] count Number of frames
+ * @param[in] stride Distance between frames in bytes (equals size for packed frames)
+ * @param[in] size Size of each frame in bytes
+ * @param[out] column Physical values (count entries)
+ *
+ * The kernel is vectorized (AVX2, SSE4.2) if supported by the CPU.
+ */
+VECTOR_DBC_EXPORT void decodeBatch(const SignalLayout & layout, const SignalConversion & conversion, const uint8_t * frames, std::size_t count, std::size_t stride, std::size_t size, double * column);
+
+/**
+ * Batch Decoder
+ *
+ * Decodes N frames of the same message into one column per signal.
+ * Signals are indexed in order of Message::signals.
+ */
+struct VECTOR_DBC_EXPORT BatchDecoder {
+    /** Signal Layouts */
+    std::vector<SignalLayout> layouts {};
+
+    /** Signal Conversions */
+    std::vector<SignalConversion> conversions {};
+
+    BatchDecoder() = default;
+
+    /**
+     * @brief Compile the signals of a message
+     * @param[in] message Message
+     */
+    explicit BatchDecoder(const Message & message);
+
+    /**
+     * @brief Decodes N frames into raw value columns
+     * @param[in] frames First frame
+     * @param[in] count Number of frames
+     * @param[in] stride Distance between frames in bytes (equals size for packed frames)
+     * @param[in] size Size of each frame in bytes
+     * @param[out] columns Column per signal with count entries (nullptr skips the signal)
+     */
+    void decode(const uint8_t * frames, std::size_t count, std::size_t stride, std::size_t size, uint64_t * const * columns) const;
+
+    /**
+     * @brief Decodes N frames into physical value columns
+     * @param[in] frames First frame
+     * @param[in] count Number of frames
+     * @param[in] stride Distance between frames in bytes (equals size for packed frames)
+     * @param[in] size Size of each frame in bytes
+     * @param[out] columns Column per signal with count entries (nullptr skips the signal)
+     */
+    void decodePhysical(const uint8_t * frames, std::size_t count, std::size_t stride, std::size_t size, double * const * columns) const;
+};
+
+}
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/CanFd.h>
+
+namespace Vector {
+namespace DBC {
+
+/** payload length per DLC */
+static const uint8_t dlcLengths[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };
+
+std::size_t dlcToLength(uint8_t dlc) {
+    return dlcLengths[dlc < 15 ? dlc : 15];
+}
+
+uint8_t lengthToDlc(std::size_t length) {
+    if (length <= 8)
+        return static_cast<uint8_t>(length);
+    uint8_t dlc = 9;
+    while ((dlc < 15) && (dlcLengths[dlc] < length))
+        ++dlc;
+    return dlc;
+}
+
+}
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/** Maximum CAN FD payload length in bytes */
+static const std::size_t canFdMaxLength = 64;
+
+/**
+ * @brief Converts a Data Length Code into the payload length
+ * @param[in] dlc Data Length Code (0..15)
+ * @return Payload length in bytes (0..8, 12, 16, 20, 24, 32, 48, 64)
+ *
+ * DLCs above 15 are treated as 15.
+ */
+VECTOR_DBC_EXPORT std::size_t dlcToLength(uint8_t dlc);
+
+/**
+ * @brief Converts a payload length into the Data Length Code
+ * @param[in] length Payload length in bytes
+ * @return Smallest Data Length Code whose length is not less than the given length
+ *
+ * Lengths above 64 are treated as 64.
+ */
+VECTOR_DBC_EXPORT uint8_t lengthToDlc(std::size_t length);
+
+}
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/CompiledMessage.h>
+
+#include <algorithm>
+#include <numeric>
+
+namespace Vector {
+namespace DBC {
+
+static_assert(sizeof(SignalDescriptor) == 32, "SignalDescriptor should fill half a cache line");
+
+SignalDescriptor SignalDescriptor::fromSignal(const Signal & signal, const SignalLayout & layout, uint32_t messageSize, uint32_t index) {
+    SignalConversion conversion = signal.conversion();
+    SignalDescriptor descriptor;
+    descriptor.mask = layout.mask;
+    descriptor.factor = conversion.factor;
+    descriptor.offset = conversion.offset;
+    descriptor.rawType = conversion.rawType;
+    descriptor.bitSize = static_cast<uint8_t>(layout.byteCount ? signal.bitSize : 0);
+    descriptor.signal = static_cast<uint16_t>(index);
+    if (layout.byteSwap)
+        descriptor.flags |= ByteSwap;
+    if (layout.valueSigned)
+        descriptor.flags |= ValueSigned;
+    std::size_t origin;
+    unsigned int windowShift;
+    if (layout.window(messageSize, origin, windowShift)) {
+        descriptor.origin = static_cast<uint16_t>(origin);
+        descriptor.windowShift = static_cast<uint8_t>(windowShift);
+        descriptor.flags |= Windowed;
+    }
+    return descriptor;
+}
+
+const uint32_t CompiledMessage::notFound;
+
+CompiledMessage::CompiledMessage(const Message & message) :
+    id(message.id),
+    size(message.size),
+    windowed(true) {
+    /* order by position in the frame, as the start bit of big endian signals is their MSB */
+    std::vector<const Signal *> ordered;
+    std::vector<SignalLayout> orderedLayouts;
+    for (const auto & signal : message.signals) {
+        ordered.push_back(&signal.second);
+        orderedLayouts.push_back(signal.second.layout());
+    }
+    std::vector<uint32_t> positions(ordered.size());
+    std::iota(positions.begin(), positions.end(), 0);
+    std::stable_sort(positions.begin(), positions.end(), [&orderedLayouts](uint32_t lhs, uint32_t rhs) {
+        const SignalLayout & lhsLayout = orderedLayouts[lhs];
+        const SignalLayout & rhsLayout = orderedLayouts[rhs];
+        if (lhsLayout.byteOffset != rhsLayout.byteOffset)
+            return lhsLayout.byteOffset < rhsLayout.byteOffset;
+        return lhsLayout.shift < rhsLayout.shift;
+    });
+
+    /* descriptors, layouts and cold signals */
+    descriptors.reserve(positions.size());
+    layouts.reserve(positions.size());
+    signals.reserve(positions.size());
+    for (uint32_t position : positions) {
+        const Signal & signal = *ordered[position];
+        const SignalLayout & layout = orderedLayouts[position];
+        SignalDescriptor descriptor = SignalDescriptor::fromSignal(signal, layout, size, position);
+        if (!(descriptor.flags & SignalDescriptor::Windowed))
+            windowed = false;
+        descriptors.push_back(descriptor);
+        layouts.push_back(layout);
+        signals.push_back(signal);
+    }
+
+    /* name index, at most half full */
+    std::size_t capacity = 4;
+    while (capacity < 2 * signals.size())
+        capacity *= 2;
+    nameIndex.assign(capacity, 0);
+    for (uint32_t position = 0; position < signals.size(); ++position) {
+        std::size_t slot = StringView(signals[position].name).hash() & (capacity - 1);
+        while (nameIndex[slot] != 0)
+            slot = (slot + 1) & (capacity - 1);
+        nameIndex[slot] = position + 1;
+    }
+}
+
+uint32_t CompiledMessage::findSignal(StringView name) const {
+    if (nameIndex.empty())
+        return notFound;
+    const std::size_t mask = nameIndex.size() - 1;
+    for (std::size_t slot = name.hash() & mask; nameIndex[slot] != 0; slot = (slot + 1) & mask) {
+        const uint32_t position = nameIndex[slot] - 1;
+        if (StringView(signals[position].name) == name)
+            return position;
+    }
+    return notFound;
+}
+
+void CompiledMessage::decode(const uint8_t * data, std::size_t size, uint64_t * rawValues) const {
+    const std::size_t count = descriptors.size();
+
+    /* one window load per signal */
+    if (windowed && (size == this->size)) {
+        for (std::size_t i = 0; i < count; ++i)
+            rawValues[i] = descriptors[i].decodeWindow(data);
+        return;
+    }
+
+    /* bounds checked */
+    for (std::size_t i = 0; i < count; ++i) {
+        if ((size == this->size) && (descriptors[i].flags & SignalDescriptor::Windowed))
+            rawValues[i] = descriptors[i].decodeWindow(data);
+        else
+            rawValues[i] = layouts[i].decode(data, size);
+    }
+}
+
+void CompiledMessage::decodePhysical(const uint8_t * data, std::size_t size, double * physicalValues) const {
+    const std::size_t count = descriptors.size();
+
+    /* one window load per signal */
+    if (windowed && (size == this->size)) {
+        for (std::size_t i = 0; i < count; ++i)
+            physicalValues[i] = descriptors[i].physicalValue(descriptors[i].decodeWindow(data));
+        return;
+    }
+
+    /* bounds checked */
+    for (std::size_t i = 0; i < count; ++i) {
+        uint64_t rawValue;
+        if ((size == this->size) && (descriptors[i].flags & SignalDescriptor::Windowed))
+            rawValue = descriptors[i].decodeWindow(data);
+        else
+            rawValue = layouts[i].decode(data, size);
+        physicalValues[i] = descriptors[i].physicalValue(rawValue);
+    }
+}
+
+}
+}
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <Vector/DBC/Message.h>
+#include <Vector/DBC/SignalConversion.h>
+#include <Vector/DBC/SignalLayout.h>
+#include <Vector/DBC/StringView.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Signal Descriptor
+ *
+ * Compact decode information of a signal (32 bytes, two per cache line),
+ * located for frames of message size.
+ */
+struct VECTOR_DBC_EXPORT SignalDescriptor {
+    /** Flags */
+    enum Flags : uint8_t {
+        /** Window is loaded as big endian word (Motorola) */
+        ByteSwap = 0x01,
+
+        /** Value Type is signed */
+        ValueSigned = 0x02,
+
+        /** Signal fits into a 64-bit window of frames of message size */
+        Windowed = 0x04
+    };
+
+    /** Mask of the raw value bits */
+    uint64_t mask {};
+
+    /** Factor */
+    double factor { 1.0 };
+
+    /** Offset */
+    double offset {};
+
+    /** First byte of the 64-bit window */
+    uint16_t origin {};
+
+    /** Position of the LSB within the window */
+    uint8_t windowShift {};
+
+    /** @copydoc Flags */
+    uint8_t flags {};
+
+    /** @copydoc SignalConversion::RawType */
+    SignalConversion::RawType rawType { SignalConversion::RawType::Unsigned };
+
+    /** Bit Size */
+    uint8_t bitSize {};
+
+    /** Signal index (position in Message::signals) */
+    uint16_t signal {};
+
+    /**
+     * @brief Build the descriptor of a signal
+     * @param[in] signal Signal
+     * @param[in] layout Signal Layout (Signal::layout)
+     * @param[in] messageSize Message size in bytes
+     * @param[in] index Signal index (position in Message::signals)
+     * @return Signal Descriptor
+     */
+    static SignalDescriptor fromSignal(const Signal & signal, const SignalLayout & layout, uint32_t messageSize, uint32_t index);
+
+    /**
+     * @brief Decodes the signal from a frame of message size
+     * @param[in] data Data
+     * @return Raw signal value
+     *
+     * Requires the Windowed flag.
+     */
+    uint64_t decodeWindow(const uint8_t * data) const {
+        uint64_t retVal = (flags & ByteSwap) ? SignalLayout::loadBigEndian(data + origin) : SignalLayout::loadLittleEndian(data + origin);
+        retVal = (retVal >> windowShift) & mask;
+
+        /* if signed and MSB is set, then fill all bits above MSB with 1 */
+        if ((flags & ValueSigned) && (retVal & ~(mask >> 1)))
+            retVal |= ~mask;
+
+        return retVal;
+    }
+
+    /**
+     * @brief Convert the raw value bits into the physical value
+     * @param[in] rawValue Raw signal value
+     * @return Physical Value
+     */
+    double physicalValue(uint64_t rawValue) const {
+        return conversion().physicalValue(rawValue);
+    }
+
+    /**
+     * @brief Get the raw to physical value conversion
+     * @return Signal Conversion
+     */
+    SignalConversion conversion() const {
+        SignalConversion conversion;
+        conversion.rawType = rawType;
+        conversion.factor = factor;
+        conversion.offset = offset;
+        conversion.mask = mask;
+        return conversion;
+    }
+};
+
+/**
+ * Compiled Message
+ *
+ * Signals of a message in a contiguous array sorted by their position in
+ * the frame (first byte, then LSB position within the window), so decoding
+ * a full message walks the frame and the descriptors linearly.
+ *
+ * The hot data, that is needed for decoding, is kept in descriptors.
+ * Everything else (names, units, comments, attributes, receivers, value
+ * descriptions) is kept in the cold signals table in the same order.
+ * Signals are accessed by position in these arrays, or by name via a
+ * hash index.
+ */
+struct VECTOR_DBC_EXPORT CompiledMessage {
+    /** Position of unknown signals */
+    static const uint32_t notFound = 0xffffffff;
+
+    /** Identifier (with bit 31 set this is extended CAN frame) */
+    uint32_t id {};
+
+    /** Size in bytes */
+    uint32_t size {};
+
+    /** All descriptors are windowed, so frames of message size are decoded without bounds checks */
+    bool windowed {};
+
+    /** Signal Descriptors (hot), sorted by position in the frame */
+    std::vector<SignalDescriptor> descriptors {};
+
+    /** Signal Layouts, for frames shorter than message size and signals spanning 9 bytes */
+    std::vector<SignalLayout> layouts {};
+
+    /** Signals (cold), same order as descriptors */
+    std::vector<Signal> signals {};
+
+    /** Name index (open addressing, position + 1 or 0 if unused) */
+    std::vector<uint32_t> nameIndex {};
+
+    CompiledMessage() = default;
+
+    /**
+     * @brief Compile a message
+     * @param[in] message Message
+     */
+    explicit CompiledMessage(const Message & message);
+
+    /**
+     * @brief Find a signal by name
+     * @param[in] name Signal Name
+     * @return Position in descriptors/signals or notFound
+     */
+    uint32_t findSignal(StringView name) const;
+
+    /**
+     * @brief Decodes all signals of a frame
+     * @param[in] data Data
+     * @param[in] size Size of data in bytes
+     * @param[out] rawValues Raw values (one per descriptor)
+     *
+     * Multiplexors are not taken into account, see MessageDecoder.
+     * Bytes beyond size are read as zero.
+     */
+    void decode(const uint8_t * data, std::size_t size, uint64_t * rawValues) const;
+
+    /**
+     * @brief Decodes all signals of a frame into physical values
+     * @param[in] data Data
+     * @param[in] size Size of data in bytes
+     * @param[out] physicalValues Physical values (one per descriptor)
+     *
+     * Multiplexors are not taken into account, see MessageDecoder.
+     * Bytes beyond size are read as zero.
+     */
+    void decodePhysical(const uint8_t * data, std::size_t size, double * physicalValues) const;
+};
+
+}
+}
@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/CompiledNetwork.h>
+
+#include <algorithm>
+#include <cstring>
+#include <set>
+#include <string>
+
+#include <Vector/DBC/MessageEncoder.h>
+
+namespace Vector {
+namespace DBC {
+
+const uint32_t CompiledNetwork::notFound;
+
+/** intern a set of strings as sorted symbols */
+static void insertSymbols(SymbolTable & symbols, const std::set<std::string> & strings, std::vector<uint32_t> & ids) {
+    const std::size_t begin = ids.size();
+    for (const std::string & string : strings)
+        ids.push_back(symbols.insert(string));
+    std::sort(ids.begin() + begin, ids.end());
+}
+
+/** check for a symbol in a sorted range */
+static bool containsSymbol(const std::vector<uint32_t> & ids, uint32_t begin, uint32_t end, uint32_t id) {
+    return std::binary_search(ids.cbegin() + begin, ids.cbegin() + end, id);
+}
+
+CompiledNetwork::CompiledNetwork(const Network & network) :
+    valueDescriptions(network) {
+    for (const auto & node : network.nodes)
+        nodes.push_back(symbols.insert(node.first));
+    messageSignalBegin.push_back(0);
+    messageTransmitterBegin.push_back(0);
+    messageFrameBegin.push_back(0);
+    signalReceiverBegin.push_back(0);
+    for (const auto & message : network.messages) {
+        messageIndex.insert(message.first, messageCount());
+        messageIds.push_back(message.first);
+        messageSizes.push_back(message.second.size);
+        messageNames.push_back(symbols.insert(message.second.name));
+        messageTransmitter.push_back(message.second.transmitter.empty() ? SymbolTable::none : symbols.insert(message.second.transmitter));
+        insertSymbols(symbols, message.second.transmitters, transmitters);
+        messageTransmitterBegin.push_back(static_cast<uint32_t>(transmitters.size()));
+
+        /* signals */
+        uint32_t signalIndex = 0;
+        for (const auto & signal : message.second.signals) {
+            SignalLayout layout = signal.second.layout();
+            signalDescriptors.push_back(SignalDescriptor::fromSignal(signal.second, layout, message.second.size, signalIndex));
+            signalLayouts.push_back(layout);
+            /* the keys are sorted, Signal::name might differ */
+            signalNames.push_back(symbols.insert(signal.first));
+            signalUnits.push_back(symbols.insert(signal.second.unit));
+            signalTypes.push_back(symbols.insert(signal.second.type));
+            insertSymbols(symbols, signal.second.receivers, receivers);
+            signalReceiverBegin.push_back(static_cast<uint32_t>(receivers.size()));
+            signalValueTables.push_back(valueDescriptions.signalTable(message.first, signalIndex));
+            ++signalIndex;
+        }
+        messageSignalBegin.push_back(static_cast<uint32_t>(signalDescriptors.size()));
+        messageVerified.push_back(message.second.layoutVerified);
+
+        /* multiplex index */
+        MultiplexIndex multiplexIndex(message.second);
+        Multiplexing multiplexing;
+        multiplexing.signalBegin = static_cast<uint32_t>(multiplexSignals.size());
+        multiplexing.rootCount = multiplexIndex.rootCount;
+        multiplexing.switchRefBegin = static_cast<uint32_t>(multiplexSwitchRefs.size());
+        multiplexing.rootSwitchCount = multiplexIndex.rootSwitchCount;
+        multiplexing.switchBegin = static_cast<uint32_t>(multiplexSwitches.size());
+        multiplexing.intervalBegin = static_cast<uint32_t>(multiplexIntervals.size());
+        messageMultiplexing.push_back(multiplexing);
+        multiplexSignals.insert(multiplexSignals.end(), multiplexIndex.signals.begin(), multiplexIndex.signals.end());
+        multiplexSwitchRefs.insert(multiplexSwitchRefs.end(), multiplexIndex.switchRefs.begin(), multiplexIndex.switchRefs.end());
+        multiplexSwitches.insert(multiplexSwitches.end(), multiplexIndex.switches.begin(), multiplexIndex.switches.end());
+        multiplexIntervals.insert(multiplexIntervals.end(), multiplexIndex.intervals.begin(), multiplexIndex.intervals.end());
+
+        /* frame with start values */
+        MessageEncoder messageEncoder(network, message.second);
+        frameTemplates.insert(frameTemplates.end(), messageEncoder.frameTemplate.begin(), messageEncoder.frameTemplate.end());
+        messageFrameBegin.push_back(static_cast<uint32_t>(frameTemplates.size()));
+    }
+}
+
+uint32_t CompiledNetwork::findSignal(uint32_t message, StringView name) const {
+    /* signal names are sorted per message */
+    auto first = signalNames.cbegin() + messageSignalBegin[message];
+    auto last = signalNames.cbegin() + messageSignalBegin[message + 1];
+    auto it = std::lower_bound(first, last, name, [this](uint32_t signalName, StringView name) {
+        return symbols.string(signalName) < name;
+    });
+    if ((it == last) || (symbols.string(*it) != name))
+        return notFound;
+    return static_cast<uint32_t>(it - first);
+}
+
+bool CompiledNetwork::isTransmitter(uint32_t message, uint32_t node) const {
+    return ((messageTransmitter[message] != SymbolTable::none) && (messageTransmitter[message] == node)) ||
+           containsSymbol(transmitters, messageTransmitterBegin[message], messageTransmitterBegin[message + 1], node);
+}
+
+bool CompiledNetwork::isReceiver(uint32_t message, uint32_t signal, uint32_t node) const {
+    const uint32_t s = messageSignalBegin[message] + signal;
+    return containsSymbol(receivers, signalReceiverBegin[s], signalReceiverBegin[s + 1], node);
+}
+
+/**
+ * Decoding of the active signals of a frame
+ *
+ * @tparam unchecked Message layout is verified and data has message size
+ * @tparam Store Stores the raw value of a signal
+ */
+template<bool unchecked, typename Store>
+struct CompiledFrameDecoder {
+    /** network */
+    const CompiledNetwork & network;
+
+    /** multiplex index of the message */
+    const CompiledNetwork::Multiplexing & multiplexing;
+
+    /** signal descriptors of the message */
+    const SignalDescriptor * descriptors;
+
+    /** signal layouts of the message */
+    const SignalLayout * layouts;
+
+    /** data */
+    const uint8_t * data;
+
+    /** size of data in bytes */
+    std::size_t size;
+
+    /** data has message size */
+    bool fullSize;
+
+    /** stores the raw value of a signal */
+    Store & store;
+
+    /** indices of the active signals (optional) */
+    uint32_t * active;
+
+    /** number of active signals */
+    std::size_t count;
+
+    /** decode a signal */
+    uint64_t decode(uint32_t signal) const {
+        if ((unchecked || fullSize) && (descriptors[signal].flags & SignalDescriptor::Windowed))
+            return descriptors[signal].decodeWindow(data);
+        if (unchecked)
+            return layouts[signal].decodeSpan(data);
+        return layouts[signal].decode(data, size);
+    }
+
+    /** store an active signal */
+    void visit(uint32_t signal, uint64_t rawValue) {
+        store(signal, rawValue);
+        if (active)
+            active[count] = signal;
+        ++count;
+    }
+
+    /** decode the frame */
+    std::size_t operator()() {
+        MultiplexWalk<CompiledFrameDecoder> {
+            network.multiplexSignals.data() + multiplexing.signalBegin,
+            network.multiplexSwitchRefs.data() + multiplexing.switchRefBegin,
+            network.multiplexSwitches.data() + multiplexing.switchBegin,
+            network.multiplexIntervals.data() + multiplexing.intervalBegin,
+            *this}(multiplexing.rootCount, multiplexing.rootSwitchCount);
+        return count;
+    }
+};
+
+/**
+ * @brief Decodes the active signals of a frame
+ * @param[in] network Network
+ * @param[in] message Message index
+ * @param[in] data Data
+ * @param[in] size Size of data in bytes
+ * @param[in] store Stores the raw value of a signal
+ * @param[out] active Indices of the active signals (optional)
+ * @return Number of active signals
+ */
+template<typename Store>
+static std::size_t decodeFrame(const CompiledNetwork & network, uint32_t message, const uint8_t * data, std::size_t size, Store store, uint32_t * active) {
+    const CompiledNetwork::Multiplexing & multiplexing = network.messageMultiplexing[message];
+    const uint32_t signalBegin = network.messageSignalBegin[message];
+    const SignalDescriptor * descriptors = network.signalDescriptors.data() + signalBegin;
+    const SignalLayout * layouts = network.signalLayouts.data() + signalBegin;
+    const bool fullSize = (size == network.messageSizes[message]);
+    if (fullSize && network.messageVerified[message])
+        return CompiledFrameDecoder<true, Store> {network, multiplexing, descriptors, layouts, data, size, fullSize, store, active, 0}();
+    return CompiledFrameDecoder<false, Store> {network, multiplexing, descriptors, layouts, data, size, fullSize, store, active, 0}();
+}
+
+std::size_t CompiledNetwork::decode(uint32_t message, const uint8_t * data, std::size_t size, uint64_t * rawValues, uint32_t * active) const {
+    auto store = [rawValues](uint32_t signal, uint64_t rawValue) {
+        rawValues[signal] = rawValue;
+    };
+    return decodeFrame(*this, message, data, size, store, active);
+}
+
+std::size_t CompiledNetwork::decodePhysical(uint32_t message, const uint8_t * data, std::size_t size, double * physicalValues, uint32_t * active) const {
+    const SignalDescriptor * descriptors = signalDescriptors.data() + messageSignalBegin[message];
+    auto store = [descriptors, physicalValues](uint32_t signal, uint64_t rawValue) {
+        physicalValues[signal] = descriptors[signal].physicalValue(rawValue);
+    };
+    return decodeFrame(*this, message, data, size, store, active);
+}
+
+void CompiledNetwork::initFrame(uint32_t message, uint8_t * data, std::size_t size) const {
+    const uint32_t frameSize = messageFrameBegin[message + 1] - messageFrameBegin[message];
+    const std::size_t copySize = std::min<std::size_t>(size, frameSize);
+    if (copySize)
+        std::memcpy(data, frameTemplates.data() + messageFrameBegin[message], copySize);
+    if (size > copySize)
+        std::memset(data + copySize, 0, size - copySize);
+}
+
+void CompiledNetwork::encode(uint32_t message, uint32_t signal, uint8_t * data, std::size_t size, uint64_t rawValue) const {
+    signalLayouts[messageSignalBegin[message] + signal].encode(data, size, rawValue);
+}
+
+void CompiledNetwork::encodePhysical(uint32_t message, uint32_t signal, uint8_t * data, std::size_t size, double physicalValue) const {
+    const uint32_t s = messageSignalBegin[message] + signal;
+    signalLayouts[s].encode(data, size, signalDescriptors[s].conversion().physicalToRawBits(physicalValue));
+}
+
+StringView CompiledNetwork::valueDescription(uint32_t message, uint32_t signal, uint64_t rawValue) const {
+    /* value descriptions have 32 bit values, or sign extended 32 bit values */
+    if (((rawValue >> 32) != 0) && ((rawValue >> 31) != 0x1ffffffff))
+        return StringView();
+    return valueDescriptions.findDescription(signalValueTables[messageSignalBegin[message] + signal], static_cast<uint32_t>(rawValue));
+}
+
+const uint32_t * CompiledNetwork::findValue(uint32_t message, uint32_t signal, StringView description) const {
+    return valueDescriptions.findValue(signalValueTables[messageSignalBegin[message] + signal], description);
+}
+
+}
+}
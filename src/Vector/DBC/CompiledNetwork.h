@@ -0,0 +1,330 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Vector/DBC/CompiledMessage.h>
+#include <Vector/DBC/MessageIdIndex.h>
+#include <Vector/DBC/MultiplexIndex.h>
+#include <Vector/DBC/Network.h>
+#include <Vector/DBC/SignalLayout.h>
+#include <Vector/DBC/StringView.h>
+#include <Vector/DBC/SymbolTable.h>
+#include <Vector/DBC/ValueDescriptionStore.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Compiled Network
+ *
+ * Read-only snapshot of a network for runtime use, laid out as
+ * contiguous tables (structure of arrays) instead of trees of maps:
+ * messages, signals, multiplex indices, value descriptions and a
+ * symbol table.
+ *
+ * Names, units, types, receivers and transmitters are interned as
+ * symbols, so repeated strings (e.g. node names) are stored once and
+ * compared as 32-bit integers.
+ *
+ * Messages are referred to by message index (position in Network::messages),
+ * signals by signal index within their message (position in Message::signals).
+ * Unlike CompiledMessage, signals are not sorted by their position in the
+ * frame: the signal index is shared with the multiplex index, the value
+ * description tables and the raw value buffers of MessageDecoder and
+ * MessageEncoder, so both decoders fill the same buffers.
+ *
+ * The snapshot is not modified after construction, and all member functions
+ * are const and don't allocate, so it can be shared between threads
+ * (e.g. as std::shared_ptr<const CompiledNetwork>). The Network can be kept
+ * for tooling or discarded.
+ *
+ * BatchDecoder, MessageDispatcher/J1939Index, the dirty tracking of
+ * MessageEncoder and AttributeResolver are not covered by the snapshot
+ * yet. They are built from the Network, which has to be kept for them.
+ */
+struct VECTOR_DBC_EXPORT CompiledNetwork {
+    /** Index of unknown messages and signals */
+    static const uint32_t notFound = 0xffffffff;
+
+    /** Multiplex index of a message within the multiplex tables */
+    struct Multiplexing {
+        /** First entry in multiplexSignals */
+        uint32_t signalBegin {};
+
+        /** Number of signals that are always active */
+        uint32_t rootCount {};
+
+        /** First entry in multiplexSwitchRefs */
+        uint32_t switchRefBegin {};
+
+        /** Number of switches that are always active */
+        uint32_t rootSwitchCount {};
+
+        /** First entry in multiplexSwitches */
+        uint32_t switchBegin {};
+
+        /** First entry in multiplexIntervals */
+        uint32_t intervalBegin {};
+    };
+
+    /** Symbols (names, units, types) */
+    SymbolTable symbols {};
+
+    /** Node Names (symbols) */
+    std::vector<uint32_t> nodes {};
+
+    /** Message Identifiers */
+    std::vector<uint32_t> messageIds {};
+
+    /** Message Sizes in bytes */
+    std::vector<uint32_t> messageSizes {};
+
+    /** Message Names (symbols) */
+    std::vector<uint32_t> messageNames {};
+
+    /** Message Transmitters (symbols, SymbolTable::none if the number of send nodes is zero or more than one) */
+    std::vector<uint32_t> messageTransmitter {};
+
+    /** First entry in transmitters per message (one more entry than messages) */
+    std::vector<uint32_t> messageTransmitterBegin {};
+
+    /** Message Transmitters (BO_TX_BU) of all messages (symbols, sorted per message) */
+    std::vector<uint32_t> transmitters {};
+
+    /** First signal per message (one more entry than messages) */
+    std::vector<uint32_t> messageSignalBegin {};
+
+    /** Message layout is verified (Message::layoutVerified) */
+    std::vector<uint8_t> messageVerified {};
+
+    /** Multiplex index per message */
+    std::vector<Multiplexing> messageMultiplexing {};
+
+    /** First byte in frameTemplates per message (one more entry than messages) */
+    std::vector<uint32_t> messageFrameBegin {};
+
+    /** Message index per identifier */
+    MessageIdIndex messageIndex {};
+
+    /** Signal Descriptors (hot, located for frames of message size) */
+    std::vector<SignalDescriptor> signalDescriptors {};
+
+    /** Signal Layouts, for frames shorter than message size and signals spanning 9 bytes */
+    std::vector<SignalLayout> signalLayouts {};
+
+    /** Signal Names (symbols, keys of Message::signals), sorted by name per message */
+    std::vector<uint32_t> signalNames {};
+
+    /** Signal Units (symbols) */
+    std::vector<uint32_t> signalUnits {};
+
+    /** Signal Types (symbols) */
+    std::vector<uint32_t> signalTypes {};
+
+    /** First entry in receivers per signal (one more entry than signals) */
+    std::vector<uint32_t> signalReceiverBegin {};
+
+    /** Receivers of all signals (symbols, sorted per signal) */
+    std::vector<uint32_t> receivers {};
+
+    /** Value description table per signal (or ValueDescriptionStore::noTable) */
+    std::vector<uint32_t> signalValueTables {};
+
+    /** Signal lists of all multiplex indices (signal index within message) */
+    std::vector<uint32_t> multiplexSignals {};
+
+    /** Switch lists of all multiplex indices (switch id within message) */
+    std::vector<uint32_t> multiplexSwitchRefs {};
+
+    /** Switches of all multiplex indices (intervals within message) */
+    std::vector<MultiplexIndex::Switch> multiplexSwitches {};
+
+    /** Intervals of all multiplex indices (signals and switch refs within message) */
+    std::vector<MultiplexIndex::Interval> multiplexIntervals {};
+
+    /** Frames with the start values (GenSigStartValue) of all messages */
+    std::vector<uint8_t> frameTemplates {};
+
+    /** Value Descriptions */
+    ValueDescriptionStore valueDescriptions {};
+
+    CompiledNetwork() = default;
+
+    /**
+     * @brief Compile a network
+     * @param[in] network Network
+     */
+    explicit CompiledNetwork(const Network & network);
+
+    /** @return Number of messages */
+    uint32_t messageCount() const {
+        return static_cast<uint32_t>(messageIds.size());
+    }
+
+    /**
+     * @brief Find a message by identifier
+     * @param[in] id Message Identifier (with bit 31 set this is extended CAN frame)
+     * @return Message index or notFound
+     */
+    uint32_t findMessage(uint32_t id) const {
+        return messageIndex.find(id);
+    }
+
+    /**
+     * @brief Get the number of signals of a message
+     * @param[in] message Message index
+     * @return Number of signals
+     */
+    uint32_t signalCount(uint32_t message) const {
+        return messageSignalBegin[message + 1] - messageSignalBegin[message];
+    }
+
+    /**
+     * @brief Find a signal by name
+     * @param[in] message Message index
+     * @param[in] name Signal Name
+     * @return Signal index or notFound
+     */
+    uint32_t findSignal(uint32_t message, StringView name) const;
+
+    /** @return String of a symbol */
+    StringView symbol(uint32_t id) const {
+        return symbols.string(id);
+    }
+
+    /** @return Message Name */
+    StringView messageName(uint32_t message) const {
+        return symbols.string(messageNames[message]);
+    }
+
+    /** @return Signal Name */
+    StringView signalName(uint32_t message, uint32_t signal) const {
+        return symbols.string(signalNames[messageSignalBegin[message] + signal]);
+    }
+
+    /** @return Signal Unit */
+    StringView signalUnit(uint32_t message, uint32_t signal) const {
+        return symbols.string(signalUnits[messageSignalBegin[message] + signal]);
+    }
+
+    /**
+     * @brief Check if a node transmits a message (BO_TX_BU or transmitter)
+     * @param[in] message Message index
+     * @param[in] node Node Name (symbol)
+     * @return true if the node transmits the message
+     */
+    bool isTransmitter(uint32_t message, uint32_t node) const;
+
+    /**
+     * @brief Check if a node receives a signal
+     * @param[in] message Message index
+     * @param[in] signal Signal index
+     * @param[in] node Node Name (symbol)
+     * @return true if the node receives the signal
+     */
+    bool isReceiver(uint32_t message, uint32_t signal, uint32_t node) const;
+
+    /**
+     * @brief Decodes the active signals of a frame into raw values
+     * @param[in] message Message index
+     * @param[in] data Data
+     * @param[in] size Size of data in bytes
+     * @param[out] rawValues Raw values (signalCount entries, only active ones are written)
+     * @param[out] active Indices of the active signals (signalCount entries, optional)
+     * @return Number of active signals
+     *
+     * Same as MessageDecoder::decode.
+     */
+    std::size_t decode(uint32_t message, const uint8_t * data, std::size_t size, uint64_t * rawValues, uint32_t * active = nullptr) const;
+
+    /**
+     * @brief Decodes the active signals of a frame into physical values
+     * @param[in] message Message index
+     * @param[in] data Data
+     * @param[in] size Size of data in bytes
+     * @param[out] physicalValues Physical values (signalCount entries, only active ones are written)
+     * @param[out] active Indices of the active signals (signalCount entries, optional)
+     * @return Number of active signals
+     *
+     * Same as MessageDecoder::decodePhysical.
+     */
+    std::size_t decodePhysical(uint32_t message, const uint8_t * data, std::size_t size, double * physicalValues, uint32_t * active = nullptr) const;
+
+    /**
+     * @brief Initializes a frame with the start values of a message
+     * @param[in] message Message index
+     * @param[out] data Data
+     * @param[in] size Size of data in bytes
+     *
+     * Bytes beyond message size are set to zero.
+     */
+    void initFrame(uint32_t message, uint8_t * data, std::size_t size) const;
+
+    /**
+     * @brief Encodes a signal into a frame
+     * @param[in] message Message index
+     * @param[in] signal Signal index
+     * @param[inout] data Data
+     * @param[in] size Size of data in bytes
+     * @param[in] rawValue Raw signal value
+     */
+    void encode(uint32_t message, uint32_t signal, uint8_t * data, std::size_t size, uint64_t rawValue) const;
+
+    /**
+     * @brief Encodes a physical signal value into a frame
+     * @param[in] message Message index
+     * @param[in] signal Signal index
+     * @param[inout] data Data
+     * @param[in] size Size of data in bytes
+     * @param[in] physicalValue Physical signal value
+     */
+    void encodePhysical(uint32_t message, uint32_t signal, uint8_t * data, std::size_t size, double physicalValue) const;
+
+    /**
+     * @brief Get the description of a raw signal value
+     * @param[in] message Message index
+     * @param[in] signal Signal index
+     * @param[in] rawValue Raw signal value
+     * @return Description (data is nullptr if not found)
+     */
+    StringView valueDescription(uint32_t message, uint32_t signal, uint64_t rawValue) const;
+
+    /**
+     * @brief Get the raw signal value of a description
+     * @param[in] message Message index
+     * @param[in] signal Signal index
+     * @param[in] description Description
+     * @return Raw signal value or nullptr if not found
+     */
+    const uint32_t * findValue(uint32_t message, uint32_t signal, StringView description) const;
+};
+
+}
+}
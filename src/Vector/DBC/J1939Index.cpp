@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+#include <Vector/DBC/J1939Index.h>
+
+namespace Vector {
+namespace DBC {
+
+const uint32_t J1939Index::notFound;
+const uint8_t J1939Index::globalAddress;
+const uint32_t J1939Index::sourceSpecific;
+
+void J1939Index::insert(uint32_t id, uint32_t index) {
+    const uint32_t pgn = parameterGroupNumber(id);
+    const uint32_t sourcePgn = (pgn << 8) | sourceAddress(id);
+    if (sourcePgns.find(sourcePgn) == notFound)
+        sourcePgns.insert(sourcePgn, index);
+
+    /* mark PGNs defined more than once, keep the first definition */
+    const uint32_t firstIndex = pgns.find(pgn);
+    if (firstIndex == notFound)
+        pgns.insert(pgn, index);
+    else if ((firstIndex & ~sourceSpecific) != index)
+        pgns.insert(pgn, firstIndex | sourceSpecific);
+}
+
+}
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstdint>
+
+#include <Vector/DBC/MessageIdIndex.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * J1939 Index
+ *
+ * Maps 29-bit J1939 identifiers to indices in a caller-owned array of
+ * message descriptors by their Parameter Group Number (PGN), so priority,
+ * source address and (for PDU1 formats) destination address can vary at
+ * runtime.
+ *
+ * A PGN is looked up in a single probe. Only if the PGN is defined by more
+ * than one message (e.g. by different source addresses), the definition of
+ * the source address is looked up in a second probe, falling back to the
+ * first definition.
+ */
+struct VECTOR_DBC_EXPORT J1939Index {
+    /** Index of unknown identifiers */
+    static const uint32_t notFound = MessageIdIndex::notFound;
+
+    /** Global (broadcast) destination address */
+    static const uint8_t globalAddress = 0xff;
+
+    /** Marker of PGNs that are defined by more than one source address */
+    static const uint32_t sourceSpecific = 0x80000000;
+
+    /** Index per PGN (or'ed with sourceSpecific) */
+    MessageIdIndex pgns {};
+
+    /** Index per PGN and source address ((pgn << 8) | sourceAddress) */
+    MessageIdIndex sourcePgns {};
+
+    /**
+     * @brief Add an identifier
+     * @param[in] id Message Identifier (bit 31 is ignored)
+     * @param[in] index Index
+     *
+     * The first identifier of a PGN (and source address) is kept,
+     * it is used for unknown source addresses.
+     */
+    void insert(uint32_t id, uint32_t index);
+
+    /**
+     * @brief Find the index of an identifier
+     * @param[in] id Message Identifier (bit 31 is ignored)
+     * @return Index or notFound
+     */
+    uint32_t find(uint32_t id) const {
+        const uint32_t pgn = parameterGroupNumber(id);
+        const uint32_t index = pgns.find(pgn);
+        if ((index == notFound) || !(index & sourceSpecific))
+            return index;
+        const uint32_t sourceIndex = sourcePgns.find((pgn << 8) | sourceAddress(id));
+        if (sourceIndex == notFound)
+            return index & ~sourceSpecific;
+        return sourceIndex;
+    }
+
+    /**
+     * @brief Parameter Group Number of an identifier
+     * @param[in] id Message Identifier (bit 31 is ignored)
+     * @return PGN (18 bit, PDU Specific cleared for PDU1 formats)
+     */
+    static uint32_t parameterGroupNumber(uint32_t id) {
+        const uint32_t pgn = (id >> 8) & 0x3ffff;
+        if (pduFormat(id) < 240)
+            return pgn & 0x3ff00;
+        return pgn;
+    }
+
+    /**
+     * @brief PDU Format of an identifier
+     * @param[in] id Message Identifier
+     * @return PDU Format (PDU1 below 240, PDU2 otherwise)
+     */
+    static uint8_t pduFormat(uint32_t id) {
+        return static_cast<uint8_t>(id >> 16);
+    }
+
+    /**
+     * @brief Priority of an identifier
+     * @param[in] id Message Identifier
+     * @return Priority (0 highest to 7 lowest)
+     */
+    static uint8_t priority(uint32_t id) {
+        return static_cast<uint8_t>((id >> 26) & 0x07);
+    }
+
+    /**
+     * @brief Source Address of an identifier
+     * @param[in] id Message Identifier
+     * @return Source Address
+     */
+    static uint8_t sourceAddress(uint32_t id) {
+        return static_cast<uint8_t>(id);
+    }
+
+    /**
+     * @brief Destination Address of an identifier
+     * @param[in] id Message Identifier
+     * @return Destination Address (globalAddress for PDU2 formats)
+     */
+    static uint8_t destinationAddress(uint32_t id) {
+        if (pduFormat(id) < 240)
+            return static_cast<uint8_t>(id >> 8);
+        return globalAddress;
+    }
+};
+
+}
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Layout Issue
+ *
+ * Problem found by the layout validation of a message.
+ */
+struct VECTOR_DBC_EXPORT LayoutIssue {
+    /** Type */
+    enum class Type : char {
+        /** Bit size is 0, above 64 or doesn't match the extended value type */
+        InvalidBitSize,
+
+        /** Signal exceeds the message size */
+        OutOfBounds,
+
+        /** Signal overlaps with another signal that can be active at the same time */
+        Overlap
+    };
+
+    /** @copydoc Type */
+    Type type { Type::InvalidBitSize };
+
+    /** Message Identifier */
+    uint32_t messageId {};
+
+    /** Signal Name */
+    std::string signalName {};
+
+    /** Name of the other signal (Overlap only) */
+    std::string otherSignalName {};
+};
+
+VECTOR_DBC_EXPORT std::ostream & operator<<(std::ostream & os, const LayoutIssue & layoutIssue);
+
+}
+}
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/LayoutValidator.h>
+
+#include <algorithm>
+#include <functional>
+
+#include <Vector/DBC/MultiplexIndex.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * @brief Checks the bit size of a signal
+ * @param[in] signal Signal
+ * @return true if the bit size is valid
+ */
+static bool validBitSize(const Signal & signal) {
+    switch (signal.extendedValueType) {
+    case Signal::ExtendedValueType::Undefined:
+    case Signal::ExtendedValueType::Integer:
+        break;
+    case Signal::ExtendedValueType::Float:
+        return signal.bitSize == 32;
+    case Signal::ExtendedValueType::Double:
+        return signal.bitSize == 64;
+    }
+    return (signal.bitSize >= 1) && (signal.bitSize <= 64);
+}
+
+/** Bit-occupancy bitmap of a message */
+struct Occupancy {
+    /** occupied bits per byte */
+    std::vector<uint8_t> bits {};
+
+    /** signal occupying each bit (8 per byte) */
+    std::vector<const Signal *> owners {};
+
+    /** bits newly occupied by each placement (byte, bits), to remove signals again */
+    std::vector<std::pair<std::size_t, uint8_t>> placed {};
+};
+
+/** Layout validation of one message */
+struct MessageValidation {
+    /** message */
+    const Message & message;
+
+    /** issues (optional) */
+    std::vector<LayoutIssue> * issues;
+
+    /** message is verified */
+    bool verified { true };
+
+    /** bits of the current signal (scratch, all zero between calls) */
+    std::vector<uint8_t> signalBits {};
+
+    /** signals the current signal overlaps with (scratch) */
+    std::vector<const Signal *> otherSignals {};
+
+    MessageValidation(const Message & message, std::vector<LayoutIssue> * issues) :
+        message(message),
+        issues(issues),
+        signalBits(message.size) {
+    }
+
+    /** report an issue */
+    void report(LayoutIssue::Type type, const Signal & signal, const Signal * otherSignal = nullptr) {
+        verified = false;
+        if (!issues)
+            return;
+        LayoutIssue issue;
+        issue.type = type;
+        issue.messageId = message.id;
+        issue.signalName = signal.name;
+        if (otherSignal)
+            issue.otherSignalName = otherSignal->name;
+        issues->push_back(issue);
+    }
+
+    /** place a signal into a bitmap and report overlaps */
+    void place(Occupancy & occupancy, const Signal & signal, const SignalLayout & layout) {
+        const std::size_t first = layout.byteOffset;
+        const std::size_t last = first + layout.byteCount;
+        layout.encode(signalBits.data(), signalBits.size(), ~0ULL);
+
+        /* overlap check, the owners of the shared bits are the signals it overlaps with */
+        otherSignals.clear();
+        for (std::size_t b = first; b < last; ++b) {
+            uint8_t overlap = occupancy.bits[b] & signalBits[b];
+            for (uint8_t bit = 0; overlap != 0; ++bit, overlap >>= 1) {
+                if ((overlap & 1) == 0)
+                    continue;
+                const Signal * otherSignal = occupancy.owners[8 * b + bit];
+                if (std::find(otherSignals.begin(), otherSignals.end(), otherSignal) == otherSignals.end()) {
+                    otherSignals.push_back(otherSignal);
+                    report(LayoutIssue::Type::Overlap, signal, otherSignal);
+                }
+            }
+        }
+
+        /* occupy the free bits */
+        for (std::size_t b = first; b < last; ++b) {
+            const uint8_t newBits = signalBits[b] & ~occupancy.bits[b];
+            signalBits[b] = 0;
+            if (newBits == 0)
+                continue;
+            occupancy.bits[b] |= newBits;
+            for (uint8_t bit = 0; bit < 8; ++bit)
+                if (newBits & (1 << bit))
+                    occupancy.owners[8 * b + bit] = &signal;
+            occupancy.placed.emplace_back(b, newBits);
+        }
+    }
+
+    /** remove the signals placed after mark from a bitmap */
+    void remove(Occupancy & occupancy, std::size_t mark) {
+        while (occupancy.placed.size() > mark) {
+            const std::size_t b = occupancy.placed.back().first;
+            const uint8_t newBits = occupancy.placed.back().second;
+            occupancy.bits[b] &= ~newBits;
+            for (uint8_t bit = 0; bit < 8; ++bit)
+                if (newBits & (1 << bit))
+                    occupancy.owners[8 * b + bit] = nullptr;
+            occupancy.placed.pop_back();
+        }
+    }
+};
+
+bool validateLayout(const Message & message, std::vector<LayoutIssue> * issues) {
+    MessageValidation validation(message, issues);
+
+    /* check bit sizes and bounds */
+    std::vector<const Signal *> signals;
+    std::vector<SignalLayout> layouts;
+    std::vector<bool> valid;
+    for (const auto & signal : message.signals) {
+        SignalLayout layout = signal.second.layout();
+        bool signalValid = true;
+        if (!validBitSize(signal.second)) {
+            validation.report(LayoutIssue::Type::InvalidBitSize, signal.second);
+            signalValid = false;
+        } else if (layout.byteOffset + layout.byteCount > message.size) {
+            validation.report(LayoutIssue::Type::OutOfBounds, signal.second);
+            signalValid = false;
+        }
+        signals.push_back(&signal.second);
+        layouts.push_back(layout);
+        valid.push_back(signalValid);
+    }
+
+    /* place the signals that can be active at the same time */
+    const MultiplexIndex multiplexIndex(message);
+    auto place = [&](Occupancy & occupancy, uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+            uint32_t signal = multiplexIndex.signals[i];
+            if (valid[signal])
+                validation.place(occupancy, *signals[signal], layouts[signal]);
+        }
+    };
+    Occupancy occupancy;
+    occupancy.bits.resize(message.size);
+    occupancy.owners.resize(8 * message.size);
+    std::function<void(uint32_t, uint32_t)> placeSwitches;
+    placeSwitches = [&](uint32_t begin, uint32_t end) {
+        for (uint32_t s = begin; s < end; ++s) {
+            const MultiplexIndex::Switch & multiplexorSwitch = multiplexIndex.switches[multiplexIndex.switchRefs[s]];
+            for (uint32_t i = multiplexorSwitch.intervalBegin; i < multiplexorSwitch.intervalEnd; ++i) {
+                /* place the interval on top of its parents and remove it again afterwards */
+                const MultiplexIndex::Interval & interval = multiplexIndex.intervals[i];
+                const std::size_t mark = occupancy.placed.size();
+                place(occupancy, interval.begin, interval.end);
+                placeSwitches(interval.switchBegin, interval.switchEnd);
+                validation.remove(occupancy, mark);
+            }
+        }
+    };
+    place(occupancy, 0, multiplexIndex.rootCount);
+    placeSwitches(0, multiplexIndex.rootSwitchCount);
+
+    return validation.verified;
+}
+
+void validateLayouts(Network & network) {
+    network.layoutIssues.clear();
+    for (auto & message : network.messages) {
+        /* pseudo message for signals that are not assigned to any message */
+        if (message.second.name == "VECTOR__INDEPENDENT_SIG_MSG") {
+            message.second.layoutVerified = false;
+            continue;
+        }
+        message.second.layoutVerified = validateLayout(message.second, &network.layoutIssues);
+    }
+}
+
+}
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <vector>
+
+#include <Vector/DBC/LayoutIssue.h>
+#include <Vector/DBC/Message.h>
+#include <Vector/DBC/Network.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * @brief Validates the signal layout of a message
+ * @param[in] message Message
+ * @param[out] issues Issues found are appended (optional)
+ * @return true if all signals have a valid bit size, are within the message size and don't overlap
+ *
+ * Signals overlap if they share bits and can be active at the same time,
+ * i.e. multiplexed signals of different switch values may share bits.
+ * Each value interval of a switch (MultiplexIndex) is checked against the
+ * always active signals and the intervals of its parent switches.
+ * The validation is done on bit-occupancy bitmaps and takes linear time
+ * in the number of signals and the message size.
+ */
+VECTOR_DBC_EXPORT bool validateLayout(const Message & message, std::vector<LayoutIssue> * issues = nullptr);
+
+/**
+ * @brief Validates the signal layouts of all messages
+ * @param[inout] network Network
+ *
+ * Sets Message::layoutVerified and Network::layoutIssues.
+ * This is done after parsing, so it only needs to be called again after
+ * changes of the network.
+ */
+VECTOR_DBC_EXPORT void validateLayouts(Network & network);
+
+}
+}
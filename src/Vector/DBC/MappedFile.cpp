@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+#include <Vector/DBC/MappedFile.h>
+
+#include <fstream>
+#include <iterator>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Vector {
+namespace DBC {
+
+MappedFile::MappedFile(const std::string & fileName) {
+    open(fileName);
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::open(const std::string & fileName) {
+    close();
+
+#if !defined(_WIN32)
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if ((fstat(fd, &st) == 0) && S_ISREG(st.st_mode)) {
+        if (st.st_size == 0) {
+            /* mmap rejects empty files */
+            ::close(fd);
+            data = "";
+            return true;
+        }
+        void * address = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address != MAP_FAILED) {
+            ::close(fd);
+#if defined(MADV_SEQUENTIAL)
+            madvise(address, static_cast<std::size_t>(st.st_size), MADV_SEQUENTIAL);
+#endif
+            data = static_cast<const char *>(address);
+            size = static_cast<std::size_t>(st.st_size);
+            mapped = true;
+            return true;
+        }
+    }
+    ::close(fd);
+#endif
+
+    /* fallback: read into buffer */
+    std::ifstream ifs(fileName, std::ios::binary);
+    if (!ifs.is_open())
+        return false;
+    buffer.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    data = buffer.empty() ? "" : buffer.data();
+    size = buffer.size();
+    return true;
+}
+
+void MappedFile::close() {
+#if !defined(_WIN32)
+    if (mapped)
+        munmap(const_cast<char *>(data), size);
+#endif
+    data = nullptr;
+    size = 0;
+    mapped = false;
+    buffer.clear();
+}
+
+}
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Mapped File
+ *
+ * Read-only view of a whole file. On POSIX systems the file is mapped
+ * into memory, elsewhere it is read into a buffer once.
+ */
+struct VECTOR_DBC_EXPORT MappedFile {
+    /** Data (nullptr if not open) */
+    const char * data {};
+
+    /** Size in bytes */
+    std::size_t size {};
+
+    /** Mapping is a memory map (otherwise data points into buffer) */
+    bool mapped { false };
+
+    /** Buffer, if the file could not be mapped */
+    std::vector<char> buffer {};
+
+    MappedFile() = default;
+
+    /**
+     * @brief Open a file
+     * @param[in] fileName File Name
+     */
+    explicit MappedFile(const std::string & fileName);
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile & operator=(const MappedFile &) = delete;
+
+    ~MappedFile();
+
+    /**
+     * @brief Open a file
+     * @param[in] fileName File Name
+     * @return true if the file was opened
+     *
+     * A previously opened file is closed first.
+     */
+    bool open(const std::string & fileName);
+
+    /** @brief Close the file */
+    void close();
+
+    /**
+     * @brief Check if a file is open
+     * @return true if open
+     */
+    bool isOpen() const {
+        return data != nullptr;
+    }
+};
+
+}
+}
@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/MemoryUsage.h>
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <Vector/DBC/Network.h>
+
+namespace Vector {
+namespace DBC {
+
+/** links of a map/set node (color, parent, left, right) */
+static const std::size_t treeNodeLinks = 4 * sizeof(void *);
+
+/** Accounting of the memory usage of a network */
+struct MemoryAccounting {
+    /** memory usage */
+    MemoryUsage & usage;
+
+    /** heap buffer of a string (none if the characters are stored inline) */
+    static std::size_t heap(const std::string & string) {
+        const char * object = reinterpret_cast<const char *>(&string);
+        if ((string.data() >= object) && (string.data() < object + sizeof(string)))
+            return 0;
+        return string.capacity() + 1;
+    }
+
+    /** map/set nodes, with the keys of maps accounted to the category */
+    template<typename Container>
+    void nodes(const Container & container, std::size_t & category) {
+        usage.containerOverhead += container.size() * treeNodeLinks;
+        category += container.size() * sizeof(typename Container::value_type);
+    }
+
+    /** string keys of a map */
+    template<typename Value>
+    void keys(const std::map<std::string, Value> & map, std::size_t & category) {
+        for (const auto & entry : map)
+            category += heap(entry.first);
+    }
+
+    /** set of strings */
+    void strings(const std::set<std::string> & strings, std::size_t & category) {
+        nodes(strings, category);
+        for (const std::string & string : strings)
+            category += heap(string);
+    }
+
+    /** vector of strings */
+    void strings(const std::vector<std::string> & strings, std::size_t & category) {
+        category += strings.size() * sizeof(std::string);
+        usage.containerOverhead += (strings.capacity() - strings.size()) * sizeof(std::string);
+        for (const std::string & string : strings)
+            category += heap(string);
+    }
+
+    /** attribute */
+    void attribute(const Attribute & attribute, std::size_t & category) {
+        category += heap(attribute.name) + heap(attribute.stringValue);
+    }
+
+    /** attribute values */
+    void attributeValues(const std::map<std::string, Attribute> & attributeValues) {
+        nodes(attributeValues, usage.attributeValues);
+        keys(attributeValues, usage.attributeValues);
+        for (const auto & attributeValue : attributeValues)
+            attribute(attributeValue.second, usage.attributeValues);
+    }
+
+    /** value descriptions */
+    void valueDescriptions(const ValueDescriptions & valueDescriptions) {
+        nodes(valueDescriptions, usage.valueDescriptions);
+        for (const auto & valueDescription : valueDescriptions)
+            usage.valueDescriptions += heap(valueDescription.second);
+    }
+
+    /** signal */
+    void signal(const Signal & signal) {
+        usage.signals += heap(signal.name) + heap(signal.unit) + heap(signal.type);
+        strings(signal.receivers, usage.signals);
+        valueDescriptions(signal.valueDescriptions);
+        usage.comments += heap(signal.comment);
+        attributeValues(signal.attributeValues);
+        nodes(signal.extendedMultiplexors, usage.signals);
+        keys(signal.extendedMultiplexors, usage.signals);
+        for (const auto & extendedMultiplexor : signal.extendedMultiplexors) {
+            usage.signals += heap(extendedMultiplexor.second.switchName);
+            nodes(extendedMultiplexor.second.valueRanges, usage.signals);
+        }
+    }
+
+    /** message */
+    void message(const Message & message) {
+        usage.messages += heap(message.name) + heap(message.transmitter);
+        strings(message.transmitters, usage.messages);
+        usage.comments += heap(message.comment);
+        attributeValues(message.attributeValues);
+        nodes(message.signalGroups, usage.messages);
+        keys(message.signalGroups, usage.messages);
+        for (const auto & signalGroup : message.signalGroups) {
+            usage.messages += heap(signalGroup.second.name);
+            strings(signalGroup.second.signals, usage.messages);
+        }
+        nodes(message.signals, usage.signals);
+        keys(message.signals, usage.signals);
+        for (const auto & signal : message.signals)
+            this->signal(signal.second);
+    }
+
+    /** network */
+    void network(const Network & network) {
+        usage.other += sizeof(Network) + heap(network.version);
+        strings(network.newSymbols, usage.other);
+        usage.comments += heap(network.comment);
+
+        /* nodes */
+        nodes(network.nodes, usage.nodes);
+        keys(network.nodes, usage.nodes);
+        for (const auto & node : network.nodes) {
+            usage.nodes += heap(node.second.name);
+            usage.comments += heap(node.second.comment);
+            attributeValues(node.second.attributeValues);
+        }
+
+        /* value tables */
+        nodes(network.valueTables, usage.valueDescriptions);
+        keys(network.valueTables, usage.valueDescriptions);
+        for (const auto & valueTable : network.valueTables) {
+            usage.valueDescriptions += heap(valueTable.second.name);
+            valueDescriptions(valueTable.second.valueDescriptions);
+        }
+
+        /* messages */
+        nodes(network.messages, usage.messages);
+        for (const auto & message : network.messages)
+            this->message(message.second);
+
+        /* environment variables */
+        nodes(network.environmentVariables, usage.environmentVariables);
+        keys(network.environmentVariables, usage.environmentVariables);
+        for (const auto & environmentVariable : network.environmentVariables) {
+            usage.environmentVariables += heap(environmentVariable.second.name) + heap(environmentVariable.second.unit);
+            strings(environmentVariable.second.accessNodes, usage.environmentVariables);
+            valueDescriptions(environmentVariable.second.valueDescriptions);
+            usage.comments += heap(environmentVariable.second.comment);
+            attributeValues(environmentVariable.second.attributeValues);
+        }
+
+        /* signal types */
+        nodes(network.signalTypes, usage.other);
+        keys(network.signalTypes, usage.other);
+        for (const auto & signalType : network.signalTypes)
+            usage.other += heap(signalType.second.name) + heap(signalType.second.unit) + heap(signalType.second.valueTable);
+
+        /* attribute definitions and defaults */
+        nodes(network.attributeDefinitions, usage.attributeDefinitions);
+        keys(network.attributeDefinitions, usage.attributeDefinitions);
+        for (const auto & attributeDefinition : network.attributeDefinitions) {
+            usage.attributeDefinitions += heap(attributeDefinition.second.name);
+            strings(attributeDefinition.second.valueType.enumValues, usage.attributeDefinitions);
+        }
+        nodes(network.attributeDefaults, usage.attributeDefinitions);
+        keys(network.attributeDefaults, usage.attributeDefinitions);
+        for (const auto & attributeDefault : network.attributeDefaults)
+            attribute(attributeDefault.second, usage.attributeDefinitions);
+
+        /* attribute values */
+        attributeValues(network.attributeValues);
+        nodes(network.attributeRelationValues, usage.attributeValues);
+        for (const auto & attributeRelation : network.attributeRelationValues) {
+            usage.attributeValues +=
+                heap(attributeRelation.first.name) +
+                heap(attributeRelation.first.nodeName) +
+                heap(attributeRelation.first.environmentVariableName) +
+                heap(attributeRelation.first.signalName);
+            attribute(attributeRelation.second, usage.attributeValues);
+            usage.attributeValues +=
+                heap(attributeRelation.second.nodeName) +
+                heap(attributeRelation.second.environmentVariableName) +
+                heap(attributeRelation.second.signalName);
+        }
+
+        /* layout issues */
+        usage.other += network.layoutIssues.size() * sizeof(LayoutIssue);
+        usage.containerOverhead += (network.layoutIssues.capacity() - network.layoutIssues.size()) * sizeof(LayoutIssue);
+        for (const LayoutIssue & layoutIssue : network.layoutIssues)
+            usage.other += heap(layoutIssue.signalName) + heap(layoutIssue.otherSignalName);
+    }
+};
+
+MemoryUsage Network::memoryUsage() const {
+    MemoryUsage usage;
+    MemoryAccounting {usage}.network(*this);
+    return usage;
+}
+
+std::ostream & operator<<(std::ostream & os, const MemoryUsage & memoryUsage) {
+    os << "messages\t" << memoryUsage.messages << std::endl;
+    os << "signals\t" << memoryUsage.signals << std::endl;
+    os << "attribute values\t" << memoryUsage.attributeValues << std::endl;
+    os << "attribute definitions\t" << memoryUsage.attributeDefinitions << std::endl;
+    os << "comments\t" << memoryUsage.comments << std::endl;
+    os << "value descriptions\t" << memoryUsage.valueDescriptions << std::endl;
+    os << "environment variables\t" << memoryUsage.environmentVariables << std::endl;
+    os << "nodes\t" << memoryUsage.nodes << std::endl;
+    os << "other\t" << memoryUsage.other << std::endl;
+    os << "container overhead\t" << memoryUsage.containerOverhead << std::endl;
+    os << "total\t" << memoryUsage.total() << std::endl;
+
+    return os;
+}
+
+}
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <ostream>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Memory Usage
+ *
+ * Estimated heap and object bytes of a network per category.
+ * Objects and their string buffers are accounted to the category they
+ * belong to, the links of map/set nodes and unused vector capacity to
+ * containerOverhead. Allocator bookkeeping is not included.
+ */
+struct VECTOR_DBC_EXPORT MemoryUsage {
+    /** Messages (BO), their transmitters (BO_TX_BU) and signal groups (SIG_GROUP) */
+    std::size_t messages {};
+
+    /** Signals (SG), their receivers and extended multiplexors (SG_MUL_VAL) */
+    std::size_t signals {};
+
+    /** Attribute Values (BA) of all objects and on relations (BA_REL) */
+    std::size_t attributeValues {};
+
+    /** Attribute Definitions (BA_DEF, BA_DEF_REL) and Defaults (BA_DEF_DEF, BA_DEF_DEF_REL) */
+    std::size_t attributeDefinitions {};
+
+    /** Comments (CM) of all objects */
+    std::size_t comments {};
+
+    /** Value Descriptions (VAL) and Value Tables (VAL_TABLE) */
+    std::size_t valueDescriptions {};
+
+    /** Environment Variables (EV) */
+    std::size_t environmentVariables {};
+
+    /** Nodes (BU) */
+    std::size_t nodes {};
+
+    /** Everything else (network, new symbols, signal types, layout issues) */
+    std::size_t other {};
+
+    /** Map/set node links and unused vector capacity */
+    std::size_t containerOverhead {};
+
+    /** @return Sum of all categories */
+    std::size_t total() const {
+        return messages + signals + attributeValues + attributeDefinitions + comments +
+               valueDescriptions + environmentVariables + nodes + other + containerOverhead;
+    }
+};
+
+VECTOR_DBC_EXPORT std::ostream & operator<<(std::ostream & os, const MemoryUsage & memoryUsage);
+
+}
+}
@@ -24,6 +24,20 @@
 namespace Vector {
 namespace DBC {
 
+const Signal * Message::findSignal(const std::string & name) const {
+    auto it = signals.find(name);
+    if (it == signals.end())
+        return nullptr;
+    return &it->second;
+}
+
+Signal * Message::findSignal(const std::string & name) {
+    auto it = signals.find(name);
+    if (it == signals.end())
+        return nullptr;
+    return &it->second;
+}
+
 std::ostream & operator<<(std::ostream & os, const Message & message) {
     os << "BO_ " << message.id;
     os << " " << message.name;
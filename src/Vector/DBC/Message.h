@@ -48,7 +48,7 @@ struct VECTOR_DBC_EXPORT Message {
     /** Name */
     std::string name {};
 
-    /** Size */
+    /** Size in bytes (up to 8 for CAN, up to 64 for CAN FD) */
     uint32_t size {};
 
     /** Transmitter (empty string if the number of send nodes is zero or more than one) */
@@ -68,6 +68,19 @@ struct VECTOR_DBC_EXPORT Message {
 
     /** Attribute Values (BA) */
     std::map<std::string, Attribute> attributeValues {};
+
+    /** Signal layout was verified by validateLayouts (valid bit sizes, in bounds, no overlaps) */
+    bool layoutVerified { false };
+
+    /**
+     * @brief Find a signal by name
+     * @param[in] name Signal Name
+     * @return Signal or nullptr if not found
+     */
+    const Signal * findSignal(const std::string & name) const;
+
+    /** @copydoc findSignal */
+    Signal * findSignal(const std::string & name);
 };
 
 std::ostream & operator<<(std::ostream & os, const Message & message);
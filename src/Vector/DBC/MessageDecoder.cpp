@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/MessageDecoder.h>
+
+namespace Vector {
+namespace DBC {
+
+MessageDecoder::MessageDecoder(const Message & message) :
+    signalCount(static_cast<uint32_t>(message.signals.size())),
+    messageSize(message.size),
+    multiplexIndex(message) {
+    for (const auto & signal : message.signals) {
+        Entry entry;
+        entry.layout = signal.second.layout();
+        entry.conversion = signal.second.conversion();
+        std::size_t origin;
+        unsigned int windowShift;
+        if (entry.layout.window(messageSize, origin, windowShift)) {
+            entry.origin = static_cast<uint16_t>(origin);
+            entry.windowShift = static_cast<uint8_t>(windowShift);
+            entry.windowed = true;
+        }
+        entries.push_back(entry);
+    }
+
+    /* verified layouts can skip the bounds checks */
+    verified = message.layoutVerified;
+}
+
+/**
+ * Decoding of the active signals of a frame
+ *
+ * @tparam unchecked Message layout is verified and data has message size
+ * @tparam Store Stores the raw value of a signal
+ */
+template<bool unchecked, typename Store>
+struct FrameDecoder {
+    /** message decoder */
+    const MessageDecoder & decoder;
+
+    /** data */
+    const uint8_t * data;
+
+    /** size of data in bytes */
+    std::size_t size;
+
+    /** stores the raw value of a signal */
+    Store & store;
+
+    /** indices of the active signals (optional) */
+    uint32_t * active;
+
+    /** number of active signals */
+    std::size_t count;
+
+    /** decode a signal */
+    uint64_t decode(uint32_t signal) const {
+        const MessageDecoder::Entry & entry = decoder.entries[signal];
+        if (unchecked)
+            return entry.windowed ? entry.layout.decodeWindow(data, entry.origin, entry.windowShift) : entry.layout.decodeSpan(data);
+        return entry.decode(data, size, size == decoder.messageSize);
+    }
+
+    /** store an active signal */
+    void visit(uint32_t signal, uint64_t rawValue) {
+        store(signal, rawValue);
+        if (active)
+            active[count] = signal;
+        ++count;
+    }
+
+    /** decode the frame */
+    std::size_t operator()() {
+        const MultiplexIndex & index = decoder.multiplexIndex;
+        MultiplexWalk<FrameDecoder> {index.signals.data(), index.switchRefs.data(), index.switches.data(), index.intervals.data(), *this}(index.rootCount, index.rootSwitchCount);
+        return count;
+    }
+};
+
+/**
+ * @brief Decodes the active signals of a frame
+ * @param[in] decoder Message Decoder
+ * @param[in] data Data
+ * @param[in] size Size of data in bytes
+ * @param[in] store Stores the raw value of a signal
+ * @param[out] active Indices of the active signals (optional)
+ * @return Number of active signals
+ */
+template<typename Store>
+static std::size_t decodeFrame(const MessageDecoder & decoder, const uint8_t * data, std::size_t size, Store store, uint32_t * active) {
+    if (decoder.verified && (size == decoder.messageSize))
+        return FrameDecoder<true, Store> {decoder, data, size, store, active, 0}();
+    return FrameDecoder<false, Store> {decoder, data, size, store, active, 0}();
+}
+
+std::size_t MessageDecoder::decode(const uint8_t * data, std::size_t size, uint64_t * rawValues, uint32_t * active) const {
+    auto store = [rawValues](uint32_t signal, uint64_t rawValue) {
+        rawValues[signal] = rawValue;
+    };
+    return decodeFrame(*this, data, size, store, active);
+}
+
+std::size_t MessageDecoder::decodePhysical(const uint8_t * data, std::size_t size, double * physicalValues, uint32_t * active) const {
+    auto store = [this, physicalValues](uint32_t signal, uint64_t rawValue) {
+        physicalValues[signal] = entries[signal].conversion.physicalValue(rawValue);
+    };
+    return decodeFrame(*this, data, size, store, active);
+}
+
+}
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Vector/DBC/Message.h>
+#include <Vector/DBC/MultiplexIndex.h>
+#include <Vector/DBC/SignalConversion.h>
+#include <Vector/DBC/SignalLayout.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Message Decoder
+ *
+ * Decodes a frame in one pass. The always active signals are decoded
+ * first, then for each multiplexor switch only the signals that are active
+ * for its value, including nested switches. The cost scales with the
+ * number of active signals. Values are written into a caller-owned array
+ * indexed by signal index, which is the position of the signal in
+ * Message::signals. Decoding doesn't allocate.
+ *
+ * Frames may be shorter than Message::size, e.g. CAN FD frames that were
+ * sent with a smaller DLC. Missing bytes are read as zero.
+ */
+struct VECTOR_DBC_EXPORT MessageDecoder {
+    /** Decode Entry */
+    struct Entry {
+        /** Signal Layout */
+        SignalLayout layout {};
+
+        /** Signal Conversion */
+        SignalConversion conversion {};
+
+        /** First byte of the 64-bit window in frames of message size */
+        uint16_t origin {};
+
+        /** Position of the LSB within the window */
+        uint8_t windowShift {};
+
+        /** Signal fits into a 64-bit window of frames of message size */
+        bool windowed {};
+
+        /**
+         * @brief Decodes the signal
+         * @param[in] data Data
+         * @param[in] size Size of data in bytes
+         * @param[in] fullSize Size equals the message size
+         * @return Raw signal value
+         */
+        uint64_t decode(const uint8_t * data, std::size_t size, bool fullSize) const {
+            if (fullSize && windowed)
+                return layout.decodeWindow(data, origin, windowShift);
+            return layout.decode(data, size);
+        }
+    };
+
+    /** Number of signals in the message */
+    uint32_t signalCount {};
+
+    /** Message size in bytes */
+    uint32_t messageSize {};
+
+    /**
+     * Message layout is verified (Message::layoutVerified). Frames of
+     * message size are then decoded without bounds checks, signals that
+     * don't fit into a window are extracted bytewise.
+     */
+    bool verified {};
+
+    /** Decode entries (one per signal) */
+    std::vector<Entry> entries {};
+
+    /** Multiplex Index */
+    MultiplexIndex multiplexIndex {};
+
+    MessageDecoder() = default;
+
+    /**
+     * @brief Compile the signals of a message
+     * @param[in] message Message
+     */
+    explicit MessageDecoder(const Message & message);
+
+    /**
+     * @brief Decodes the active signals of a frame into raw values
+     * @param[in] data Data
+     * @param[in] size Size of data in bytes
+     * @param[out] rawValues Raw values (signalCount entries, only active ones are written)
+     * @param[out] active Indices of the active signals (signalCount entries, optional)
+     * @return Number of active signals
+     */
+    std::size_t decode(const uint8_t * data, std::size_t size, uint64_t * rawValues, uint32_t * active = nullptr) const;
+
+    /**
+     * @brief Decodes the active signals of a frame into physical values
+     * @param[in] data Data
+     * @param[in] size Size of data in bytes
+     * @param[out] physicalValues Physical values (signalCount entries, only active ones are written)
+     * @param[out] active Indices of the active signals (signalCount entries, optional)
+     * @return Number of active signals
+     */
+    std::size_t decodePhysical(const uint8_t * data, std::size_t size, double * physicalValues, uint32_t * active = nullptr) const;
+};
+
+}
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/MessageDispatcher.h>
+
+namespace Vector {
+namespace DBC {
+
+MessageDispatcher::MessageDispatcher(const Network & network) {
+    ids.reserve(network.messages.size());
+    decoders.reserve(network.messages.size());
+    for (const auto & message : network.messages) {
+        index.insert(message.first, static_cast<uint32_t>(ids.size()));
+        if (message.first & 0x80000000)
+            j1939Index.insert(message.first, static_cast<uint32_t>(ids.size()));
+        ids.push_back(message.first);
+        decoders.emplace_back(message.second);
+    }
+}
+
+}
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <Vector/DBC/J1939Index.h>
+#include <Vector/DBC/MessageDecoder.h>
+#include <Vector/DBC/MessageIdIndex.h>
+#include <Vector/DBC/Network.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Message Dispatcher
+ *
+ * Compiled message decoders of a network, looked up by message identifier
+ * on the receive path.
+ */
+struct VECTOR_DBC_EXPORT MessageDispatcher {
+    /** Message Identifiers, same order as decoders */
+    std::vector<uint32_t> ids {};
+
+    /** Message Decoders */
+    std::vector<MessageDecoder> decoders {};
+
+    /** Index into ids/decoders per identifier */
+    MessageIdIndex index {};
+
+    /** Index into ids/decoders per PGN of the extended identifiers */
+    J1939Index j1939Index {};
+
+    MessageDispatcher() = default;
+
+    /**
+     * @brief Compile the messages of a network
+     * @param[in] network Network
+     */
+    explicit MessageDispatcher(const Network & network);
+
+    /**
+     * @brief Find the decoder of a message
+     * @param[in] id Message Identifier (with bit 31 set this is extended CAN frame)
+     * @return Message Decoder or nullptr if not found
+     */
+    const MessageDecoder * findDecoder(uint32_t id) const {
+        const uint32_t i = index.find(id);
+        if (i == MessageIdIndex::notFound)
+            return nullptr;
+        return &decoders[i];
+    }
+
+    /**
+     * @brief Find the decoder of a J1939 message
+     * @param[in] id Message Identifier (29 bit, bit 31 is ignored)
+     * @return Message Decoder or nullptr if not found
+     *
+     * Priority, source address and destination address (PDU1) of the
+     * identifier are ignored, see J1939Index::sourceAddress to get them.
+     */
+    const MessageDecoder * findJ1939Decoder(uint32_t id) const {
+        const uint32_t i = j1939Index.find(id);
+        if (i == J1939Index::notFound)
+            return nullptr;
+        return &decoders[i];
+    }
+};
+
+}
+}
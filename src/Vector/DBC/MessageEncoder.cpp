@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/MessageEncoder.h>
+
+#include <algorithm>
+
+namespace Vector {
+namespace DBC {
+
+/* compilers turn this into a single byte swap instruction */
+static inline uint64_t byteSwap(uint64_t v) {
+    v = ((v & 0x00FF00FF00FF00FFULL) << 8) | ((v >> 8) & 0x00FF00FF00FF00FFULL);
+    v = ((v & 0x0000FFFF0000FFFFULL) << 16) | ((v >> 16) & 0x0000FFFF0000FFFFULL);
+    return (v << 32) | (v >> 32);
+}
+
+/** Name of the start value attribute */
+static const char * const startValueAttributeName = "GenSigStartValue";
+
+/**
+ * @brief Get the GenSigStartValue of a signal
+ * @param[in] network Network
+ * @param[in] signal Signal
+ * @return Raw start value
+ */
+static double startValue(const Network & network, const Signal & signal) {
+    auto attributeDefinition = network.attributeDefinitions.find(startValueAttributeName);
+    if (attributeDefinition == network.attributeDefinitions.cend())
+        return 0.0;
+
+    /* attribute value, otherwise default */
+    const Attribute * attribute = nullptr;
+    auto attributeValue = signal.attributeValues.find(startValueAttributeName);
+    if (attributeValue != signal.attributeValues.cend()) {
+        attribute = &attributeValue->second;
+    } else {
+        auto attributeDefault = network.attributeDefaults.find(startValueAttributeName);
+        if (attributeDefault != network.attributeDefaults.cend())
+            attribute = &attributeDefault->second;
+    }
+    if (!attribute)
+        return 0.0;
+
+    switch (attributeDefinition->second.valueType.type) {
+    case AttributeValueType::Type::Int:
+        return attribute->integerValue;
+    case AttributeValueType::Type::Hex:
+        return attribute->hexValue;
+    case AttributeValueType::Type::Float:
+        return attribute->floatValue;
+    case AttributeValueType::Type::String:
+    case AttributeValueType::Type::Enum:
+        break;
+    }
+    return 0.0;
+}
+
+MessageEncoder::MessageEncoder(const Network & network, const Message & message) {
+    const std::size_t size = message.size;
+    for (const auto & signal : message.signals) {
+        Entry entry;
+        entry.layout = signal.second.layout();
+        entry.conversion = signal.second.conversion();
+        std::size_t origin;
+        unsigned int windowShift;
+        if (entry.layout.window(size, origin, windowShift)) {
+            entry.origin = static_cast<uint16_t>(origin);
+            entry.windowShift = static_cast<uint8_t>(windowShift);
+            entry.windowed = true;
+        }
+        entries.push_back(entry);
+        startValues.push_back(entry.conversion.rawBits(startValue(network, signal.second)));
+    }
+
+    /* frame template */
+    frameTemplate.resize(size);
+    for (std::size_t s = 0; s < entries.size(); ++s)
+        entries[s].layout.encode(frameTemplate.data(), size, startValues[s]);
+
+    /* one spare lane for windows crossing the last lane */
+    valueLanes.resize(size / 8 + 2);
+    maskLanes.resize(size / 8 + 2);
+    valueBytes.resize(size);
+    maskBytes.resize(size);
+    dirtySignals.reserve(entries.size());
+    reset();
+}
+
+void MessageEncoder::setRawValue(uint32_t index, uint64_t rawValue) {
+    rawValues[index] = rawValue;
+    if (dirtyFlags[index]) {
+        /* move to the end, so the signal set last wins on shared bits */
+        if (dirtySignals.back() != index) {
+            dirtySignals.erase(std::find(dirtySignals.begin(), dirtySignals.end(), index));
+            dirtySignals.push_back(index);
+        }
+        return;
+    }
+    dirtyFlags[index] = 1;
+    dirtySignals.push_back(index);
+}
+
+void MessageEncoder::setPhysicalValue(uint32_t index, double physicalValue) {
+    setRawValue(index, entries[index].conversion.physicalToRawBits(physicalValue));
+}
+
+void MessageEncoder::merge(std::size_t lane, uint64_t value, uint64_t mask) {
+    valueLanes[lane] = (valueLanes[lane] & ~mask) | value;
+    maskLanes[lane] |= mask;
+}
+
+const std::vector<uint8_t> & MessageEncoder::frame() {
+    if (dirtySignals.empty())
+        return frameData;
+
+    /* merge the changed signals into the lanes in the order they were set */
+    std::size_t firstLane = valueLanes.size();
+    std::size_t lastLane = 0;
+    for (uint32_t index : dirtySignals) {
+        const Entry & entry = entries[index];
+        dirtyFlags[index] = 0;
+        if (entry.windowed) {
+            /* window in little endian byte order */
+            uint64_t mask = entry.layout.mask << entry.windowShift;
+            uint64_t value = (rawValues[index] << entry.windowShift) & mask;
+            if (entry.layout.byteSwap) {
+                mask = byteSwap(mask);
+                value = byteSwap(value);
+            }
+
+            /* distribute the window over a lane pair */
+            std::size_t lane = entry.origin / 8;
+            unsigned int laneShift = 8 * (entry.origin % 8);
+            merge(lane, value << laneShift, mask << laneShift);
+            if (laneShift)
+                merge(lane + 1, value >> (64 - laneShift), mask >> (64 - laneShift));
+            firstLane = std::min(firstLane, lane);
+            lastLane = std::max(lastLane, lane + 1);
+        } else {
+            /* short frames and signals spanning nine bytes are merged bytewise */
+            const std::size_t first = entry.layout.byteOffset;
+            const std::size_t last = std::min(first + entry.layout.byteCount, frameData.size());
+            if (first >= last)
+                continue;
+            entry.layout.encode(maskBytes.data(), maskBytes.size(), ~0ULL);
+            entry.layout.encode(valueBytes.data(), valueBytes.size(), rawValues[index]);
+            for (std::size_t b = first; b < last; ++b) {
+                unsigned int byteShift = 8 * (b % 8);
+                merge(b / 8, uint64_t(valueBytes[b]) << byteShift, uint64_t(maskBytes[b]) << byteShift);
+                maskBytes[b] = 0;
+                valueBytes[b] = 0;
+            }
+            firstLane = std::min(firstLane, first / 8);
+            lastLane = std::max(lastLane, (last - 1) / 8);
+        }
+    }
+    dirtySignals.clear();
+
+    /* apply them in a single pass */
+    for (std::size_t lane = firstLane; lane <= lastLane; ++lane) {
+        std::size_t b = 8 * lane;
+        if (b + 8 <= frameData.size()) {
+            uint8_t * p = frameData.data() + b;
+            SignalLayout::storeLittleEndian(p, (SignalLayout::loadLittleEndian(p) & ~maskLanes[lane]) | valueLanes[lane]);
+        } else {
+            for (unsigned int i = 0; b + i < frameData.size(); ++i)
+                frameData[b + i] = (frameData[b + i] & ~uint8_t(maskLanes[lane] >> (8 * i))) | uint8_t(valueLanes[lane] >> (8 * i));
+        }
+        valueLanes[lane] = 0;
+        maskLanes[lane] = 0;
+    }
+
+    return frameData;
+}
+
+void MessageEncoder::reset() {
+    frameData = frameTemplate;
+    rawValues = startValues;
+    dirtySignals.clear();
+    dirtyFlags.assign(entries.size(), 0);
+}
+
+}
+}
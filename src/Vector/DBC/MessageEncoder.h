@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Vector/DBC/Message.h>
+#include <Vector/DBC/Network.h>
+#include <Vector/DBC/SignalConversion.h>
+#include <Vector/DBC/SignalLayout.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Message Encoder
+ *
+ * Keeps a cached frame of a message. The frame is initialized from a
+ * template that contains the GenSigStartValue of all signals. Signals are
+ * set by signal index, which is the position of the signal in
+ * Message::signals. Only signals that changed since the last frame are
+ * encoded. Their bits are merged into values and masks of 8 byte lanes,
+ * which are applied to the cached frame in a single pass. Signals are
+ * merged in the order they were set, so on shared bits (e.g. multiplexed
+ * signals) the signal set last wins.
+ */
+struct VECTOR_DBC_EXPORT MessageEncoder {
+    /** Encode Entry */
+    struct Entry {
+        /** Signal Layout */
+        SignalLayout layout {};
+
+        /** Signal Conversion */
+        SignalConversion conversion {};
+
+        /** First byte of the 64-bit window */
+        uint16_t origin {};
+
+        /** Position of the LSB within the window */
+        uint8_t windowShift {};
+
+        /** Signal fits into a 64-bit window, otherwise it's merged bytewise */
+        bool windowed {};
+    };
+
+    /** Encode entries (one per signal) */
+    std::vector<Entry> entries {};
+
+    /** Frame template with start values */
+    std::vector<uint8_t> frameTemplate {};
+
+    /** Start raw values (one per signal) */
+    std::vector<uint64_t> startValues {};
+
+    /** Current raw values (one per signal) */
+    std::vector<uint64_t> rawValues {};
+
+    /** Cached frame */
+    std::vector<uint8_t> frameData {};
+
+    /** Signals changed since the last frame, in the order they were set */
+    std::vector<uint32_t> dirtySignals {};
+
+    /** Signal is in dirtySignals (one per signal) */
+    std::vector<uint8_t> dirtyFlags {};
+
+    /** Merged values of the changed signals per 8 byte lane (scratch) */
+    std::vector<uint64_t> valueLanes {};
+
+    /** Merged masks of the changed signals per 8 byte lane (scratch) */
+    std::vector<uint64_t> maskLanes {};
+
+    /** Value bytes of a signal that is not windowed (scratch, all zero between calls) */
+    std::vector<uint8_t> valueBytes {};
+
+    /** Mask bytes of a signal that is not windowed (scratch, all zero between calls) */
+    std::vector<uint8_t> maskBytes {};
+
+    MessageEncoder() = default;
+
+    /**
+     * @brief Compile the signals of a message
+     * @param[in] network Network (for attribute definitions and defaults)
+     * @param[in] message Message
+     *
+     * The start value of a signal is its GenSigStartValue attribute value,
+     * otherwise the attribute default, otherwise 0.
+     */
+    MessageEncoder(const Network & network, const Message & message);
+
+    /**
+     * @brief Set the raw value of a signal
+     * @param[in] index Signal Index
+     * @param[in] rawValue Raw signal value
+     */
+    void setRawValue(uint32_t index, uint64_t rawValue);
+
+    /**
+     * @brief Set the physical value of a signal
+     * @param[in] index Signal Index
+     * @param[in] physicalValue Physical Value
+     */
+    void setPhysicalValue(uint32_t index, double physicalValue);
+
+    /**
+     * @brief Encode the changed signals into the cached frame
+     * @return Frame data
+     */
+    const std::vector<uint8_t> & frame();
+
+    /**
+     * @brief Merge bits of a signal into a lane
+     * @param[in] lane Lane
+     * @param[in] value Value bits (within mask)
+     * @param[in] mask Mask bits, replacing bits of signals merged before
+     */
+    void merge(std::size_t lane, uint64_t value, uint64_t mask);
+
+    /**
+     * @brief Reset the frame and all raw values to the start values
+     */
+    void reset();
+};
+
+}
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/MessageIdIndex.h>
+
+namespace Vector {
+namespace DBC {
+
+const uint32_t MessageIdIndex::notFound;
+const uint32_t MessageIdIndex::standardIdCount;
+
+/** insert into the hash table, which has a free slot */
+static void insertSlot(std::vector<MessageIdIndex::Slot> & slots, uint32_t id, uint32_t index, uint32_t & slotCount) {
+    const std::size_t mask = slots.size() - 1;
+    for (std::size_t slot = MessageIdIndex::hash(id) & mask; ; slot = (slot + 1) & mask) {
+        if (slots[slot].id == id) {
+            slots[slot].index = index;
+            return;
+        }
+        if (slots[slot].id == 0) {
+            slots[slot].id = id;
+            slots[slot].index = index;
+            ++slotCount;
+            return;
+        }
+    }
+}
+
+MessageIdIndex::MessageIdIndex() :
+    standardIds(standardIdCount, notFound),
+    slots(16) {
+}
+
+void MessageIdIndex::insert(uint32_t id, uint32_t index) {
+    if (id < standardIdCount) {
+        standardIds[id] = index;
+        return;
+    }
+
+    /* grow at half load */
+    if (2 * (slotCount + 1) > slots.size()) {
+        std::vector<Slot> oldSlots(2 * slots.size());
+        oldSlots.swap(slots);
+        slotCount = 0;
+        for (const Slot & slot : oldSlots) {
+            if (slot.id != 0)
+                insertSlot(slots, slot.id, slot.index, slotCount);
+        }
+    }
+    insertSlot(slots, id, index, slotCount);
+}
+
+}
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Message Identifier Index
+ *
+ * Maps message identifiers to indices in a caller-owned array of
+ * message descriptors in a single probe.
+ *
+ * Standard identifiers (below 2048) are looked up in a direct table.
+ * Extended identifiers (bit 31 set) and all other identifiers are looked
+ * up in an open addressing hash table, which is kept at most half full,
+ * so unknown identifiers usually end at the first empty slot.
+ */
+struct VECTOR_DBC_EXPORT MessageIdIndex {
+    /** Index of unknown identifiers */
+    static const uint32_t notFound = 0xffffffff;
+
+    /** Number of standard identifiers (11 bit) */
+    static const uint32_t standardIdCount = 2048;
+
+    /** Hash table slot */
+    struct Slot {
+        /** Identifier (0 if unused, as 0 is a standard identifier) */
+        uint32_t id {};
+
+        /** Index */
+        uint32_t index { notFound };
+    };
+
+    /** Index per standard identifier */
+    std::vector<uint32_t> standardIds {};
+
+    /** Hash table of all other identifiers (power of two size) */
+    std::vector<Slot> slots {};
+
+    /** Number of used slots */
+    uint32_t slotCount {};
+
+    MessageIdIndex();
+
+    /**
+     * @brief Add or replace an identifier
+     * @param[in] id Message Identifier
+     * @param[in] index Index
+     */
+    void insert(uint32_t id, uint32_t index);
+
+    /**
+     * @brief Find the index of an identifier
+     * @param[in] id Message Identifier
+     * @return Index or notFound
+     */
+    uint32_t find(uint32_t id) const {
+        if (id < standardIdCount)
+            return standardIds[id];
+        const std::size_t mask = slots.size() - 1;
+        for (std::size_t slot = hash(id) & mask; ; slot = (slot + 1) & mask) {
+            if (slots[slot].id == id)
+                return slots[slot].index;
+            if (slots[slot].id == 0)
+                return notFound;
+        }
+    }
+
+    /**
+     * @brief Hash of an identifier
+     * @param[in] id Message Identifier
+     * @return Hash (upper bits of a multiplicative hash)
+     */
+    static std::size_t hash(uint32_t id) {
+        return static_cast<std::size_t>((uint64_t(id) * 0x9e3779b97f4a7c15ULL) >> 32);
+    }
+};
+
+}
+}
@@ -0,0 +1,217 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/MultiplexIndex.h>
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+
+namespace Vector {
+namespace DBC {
+
+/** Builder of the multiplex index */
+struct MultiplexIndexBuilder {
+    /** value range of a signal */
+    struct Range {
+        uint32_t signal;
+        uint64_t low;
+        uint64_t high;
+    };
+
+    /** range boundary of a signal */
+    struct Boundary {
+        uint64_t value;
+        uint32_t signal;
+        bool start;
+    };
+
+    /** index */
+    MultiplexIndex & index;
+
+    /** switch signal index per switch name */
+    std::map<std::string, uint32_t> switchSignals {};
+
+    /** ranges of the multiplexed signals per switch signal index */
+    std::map<uint32_t, std::vector<Range>> children {};
+
+    /** switch id per switch signal index */
+    std::map<uint32_t, uint32_t> switchIds {};
+
+    explicit MultiplexIndexBuilder(MultiplexIndex & index) :
+        index(index) {
+    }
+
+    /** build a switch and its nested switches, returns the switch id */
+    uint32_t build(uint32_t switchSignal) {
+        /* each signal has a single parent switch, so each switch is built once */
+        auto it = switchIds.find(switchSignal);
+        if (it != switchIds.end())
+            return it->second;
+        const uint32_t switchId = static_cast<uint32_t>(index.switches.size());
+        switchIds[switchSignal] = switchId;
+        index.switches.push_back(MultiplexIndex::Switch());
+        index.switches[switchId].signal = switchSignal;
+        const std::vector<Range> & ranges = children[switchSignal];
+
+        /* nested switches first, as they append intervals on their own */
+        building.insert(switchSignal);
+        std::map<uint32_t, uint32_t> nestedSwitchIds;
+        for (const Range & range : ranges) {
+            /* switches being built are parents of this one, so cyclic definitions are not followed */
+            if (switchSignalIndices.count(range.signal) && !building.count(range.signal))
+                nestedSwitchIds[range.signal] = build(range.signal);
+        }
+        building.erase(switchSignal);
+
+        /* range boundaries: signals become active at low and inactive after high */
+        std::vector<Boundary> boundaries;
+        for (const Range & range : ranges) {
+            boundaries.push_back(Boundary{range.low, range.signal, true});
+            boundaries.push_back(Boundary{range.high + 1, range.signal, false});
+        }
+        std::sort(boundaries.begin(), boundaries.end(), [](const Boundary & a, const Boundary & b) {
+            return a.value < b.value;
+        });
+
+        /* sweep the elementary intervals, signals with overlapping ranges are listed once */
+        std::map<uint32_t, uint32_t> active;
+        index.switches[switchId].intervalBegin = static_cast<uint32_t>(index.intervals.size());
+        for (std::size_t b = 0; b < boundaries.size();) {
+            const uint64_t low = boundaries[b].value;
+            for (; (b < boundaries.size()) && (boundaries[b].value == low); ++b) {
+                if (boundaries[b].start)
+                    ++active[boundaries[b].signal];
+                else if (--active[boundaries[b].signal] == 0)
+                    active.erase(boundaries[b].signal);
+            }
+            if (active.empty())
+                continue;
+            MultiplexIndex::Interval interval;
+            interval.low = static_cast<uint32_t>(low);
+            interval.high = static_cast<uint32_t>(boundaries[b].value - 1);
+            interval.begin = static_cast<uint32_t>(index.signals.size());
+            interval.switchBegin = static_cast<uint32_t>(index.switchRefs.size());
+            for (const auto & signal : active) {
+                index.signals.push_back(signal.first);
+                auto nestedSwitchId = nestedSwitchIds.find(signal.first);
+                if (nestedSwitchId != nestedSwitchIds.end())
+                    index.switchRefs.push_back(nestedSwitchId->second);
+            }
+            interval.end = static_cast<uint32_t>(index.signals.size());
+            interval.switchEnd = static_cast<uint32_t>(index.switchRefs.size());
+            index.intervals.push_back(interval);
+        }
+        index.switches[switchId].intervalEnd = static_cast<uint32_t>(index.intervals.size());
+
+        return switchId;
+    }
+
+    /** signal indices of all switches */
+    std::set<uint32_t> switchSignalIndices {};
+
+    /** signal indices of the switches being built */
+    std::set<uint32_t> building {};
+};
+
+MultiplexIndex::MultiplexIndex(const Message & message) {
+    MultiplexIndexBuilder builder(*this);
+
+    /* switches */
+    uint32_t signalIndex = 0;
+    uint32_t rootSwitch = 0;
+    bool hasRootSwitch = false;
+    for (const auto & signal : message.signals) {
+        if ((signal.second.multiplexor == Signal::Multiplexor::MultiplexorSwitch) || signal.second.nestedMultiplexorSwitch) {
+            builder.switchSignals[signal.first] = signalIndex;
+            builder.switchSignalIndices.insert(signalIndex);
+        }
+        if ((signal.second.multiplexor == Signal::Multiplexor::MultiplexorSwitch) && !hasRootSwitch) {
+            rootSwitch = signalIndex;
+            hasRootSwitch = true;
+        }
+        ++signalIndex;
+    }
+
+    /* parent switch and value ranges of each signal */
+    std::vector<uint32_t> roots;
+    signalIndex = 0;
+    for (const auto & signal : message.signals) {
+        bool multiplexed = false;
+        if (!signal.second.extendedMultiplexors.empty()) {
+            /* extended multiplexing (SG_MUL_VAL) */
+            const ExtendedMultiplexor & extendedMultiplexor = signal.second.extendedMultiplexors.cbegin()->second;
+            auto switchSignal = builder.switchSignals.find(extendedMultiplexor.switchName);
+            if ((switchSignal != builder.switchSignals.end()) && (switchSignal->second != signalIndex)) {
+                for (const auto & valueRange : extendedMultiplexor.valueRanges) {
+                    if (valueRange.first <= valueRange.second)
+                        builder.children[switchSignal->second].push_back(MultiplexIndexBuilder::Range{signalIndex, valueRange.first, valueRange.second});
+                }
+                multiplexed = true;
+            }
+        } else if ((signal.second.multiplexor == Signal::Multiplexor::MultiplexedSignal) && hasRootSwitch) {
+            /* simple multiplexing */
+            builder.children[rootSwitch].push_back(MultiplexIndexBuilder::Range{signalIndex, signal.second.multiplexerSwitchValue, signal.second.multiplexerSwitchValue});
+            multiplexed = true;
+        }
+        if (!multiplexed)
+            roots.push_back(signalIndex);
+        ++signalIndex;
+    }
+
+    /* always active signals and switches */
+    signals = roots;
+    rootCount = static_cast<uint32_t>(signals.size());
+    std::vector<uint32_t> rootSwitches;
+    for (uint32_t root : roots) {
+        if (builder.switchSignalIndices.count(root))
+            rootSwitches.push_back(root);
+    }
+    switchRefs.resize(rootSwitches.size());
+    rootSwitchCount = static_cast<uint32_t>(rootSwitches.size());
+    for (uint32_t s = 0; s < rootSwitchCount; ++s) {
+        /* build appends to switchRefs */
+        uint32_t switchId = builder.build(rootSwitches[s]);
+        switchRefs[s] = switchId;
+    }
+}
+
+const MultiplexIndex::Interval * MultiplexIndex::interval(uint32_t switchId, uint64_t value) const {
+    const Switch & multiplexorSwitch = switches[switchId];
+    return findInterval(intervals.data() + multiplexorSwitch.intervalBegin, intervals.data() + multiplexorSwitch.intervalEnd, value);
+}
+
+const MultiplexIndex::Interval * MultiplexIndex::findInterval(const Interval * first, const Interval * last, uint64_t value) {
+    const Interval * it = std::upper_bound(first, last, value, [](uint64_t value, const Interval & interval) {
+        return value < interval.low;
+    });
+    if (it == first)
+        return nullptr;
+    --it;
+    if (value > it->high)
+        return nullptr;
+    return it;
+}
+
+}
+}
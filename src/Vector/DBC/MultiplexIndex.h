@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <Vector/DBC/Message.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Multiplex Index
+ *
+ * Maps multiplexor switch values to the signals that are active for them.
+ * Signals are referred to by signal index, which is the position of the
+ * signal in Message::signals.
+ *
+ * Each switch has a sorted table of disjoint value intervals. Each interval
+ * refers to a contiguous list of the signals active within it, and to the
+ * nested switches among them. The intervals come from the multiplexer
+ * switch values (m<value>) or from the value ranges of the extended
+ * multiplexing (SG_MUL_VAL), which also define nested switches (m<value>M).
+ * Cyclic switch definitions are not followed, so the nested switches form
+ * a tree and walking them always terminates.
+ */
+struct VECTOR_DBC_EXPORT MultiplexIndex {
+    /** Value interval of a switch */
+    struct Interval {
+        /** Lowest switch value */
+        uint32_t low {};
+
+        /** Highest switch value */
+        uint32_t high {};
+
+        /** First signal in signals */
+        uint32_t begin {};
+
+        /** Signal after the last one in signals */
+        uint32_t end {};
+
+        /** First nested switch in switchRefs */
+        uint32_t switchBegin {};
+
+        /** Switch after the last nested one in switchRefs */
+        uint32_t switchEnd {};
+    };
+
+    /** Multiplexor Switch */
+    struct Switch {
+        /** Signal index of the switch */
+        uint32_t signal {};
+
+        /** First interval in intervals */
+        uint32_t intervalBegin {};
+
+        /** Interval after the last one in intervals */
+        uint32_t intervalEnd {};
+    };
+
+    /**
+     * Signal lists.
+     * The first rootCount signals are always active, followed by the
+     * signal lists of all intervals.
+     */
+    std::vector<uint32_t> signals {};
+
+    /** Number of signals that are always active */
+    uint32_t rootCount {};
+
+    /**
+     * Switch lists (indices into switches).
+     * The first rootSwitchCount switches are always active, followed by
+     * the nested switch lists of all intervals.
+     */
+    std::vector<uint32_t> switchRefs {};
+
+    /** Number of switches that are always active */
+    uint32_t rootSwitchCount {};
+
+    /** Switches */
+    std::vector<Switch> switches {};
+
+    /** Intervals of all switches, sorted by value per switch */
+    std::vector<Interval> intervals {};
+
+    MultiplexIndex() = default;
+
+    /**
+     * @brief Build the index of a message
+     * @param[in] message Message
+     *
+     * Signals referring to unknown switches are treated as always active.
+     */
+    explicit MultiplexIndex(const Message & message);
+
+    /**
+     * @brief Get the interval of a switch value
+     * @param[in] switchId Switch (index into switches)
+     * @param[in] value Switch value
+     * @return Interval or nullptr if no signals are active for this value
+     */
+    const Interval * interval(uint32_t switchId, uint64_t value) const;
+
+    /**
+     * @brief Find the interval of a switch value
+     * @param[in] first First interval of a switch
+     * @param[in] last Interval after the last one of a switch
+     * @param[in] value Switch value
+     * @return Interval or nullptr if no interval contains the value
+     */
+    static const Interval * findInterval(const Interval * first, const Interval * last, uint64_t value);
+};
+
+/**
+ * Multiplex Walk
+ *
+ * Visits the signals that are active in a frame, following the switch
+ * values into the nested switches. It works on the arrays of a
+ * MultiplexIndex or on their copies in a CompiledNetwork.
+ *
+ * @tparam Frame Provides decode(signal), returning the raw value of a signal,
+ *   and visit(signal, rawValue), called for each active signal
+ */
+template<typename Frame>
+struct MultiplexWalk {
+    /** Signal lists (MultiplexIndex::signals) */
+    const uint32_t * signals;
+
+    /** Switch lists (MultiplexIndex::switchRefs) */
+    const uint32_t * switchRefs;
+
+    /** Switches (MultiplexIndex::switches) */
+    const MultiplexIndex::Switch * switches;
+
+    /** Intervals (MultiplexIndex::intervals) */
+    const MultiplexIndex::Interval * intervals;
+
+    /** Frame */
+    Frame & frame;
+
+    /** visit a signal list */
+    void visitSignals(uint32_t begin, uint32_t end) const {
+        for (uint32_t i = begin; i < end; ++i) {
+            uint32_t signal = signals[i];
+            frame.visit(signal, frame.decode(signal));
+        }
+    }
+
+    /** visit the signals active for a switch list, recursing into nested switches */
+    void visitSwitches(uint32_t begin, uint32_t end) const {
+        for (uint32_t i = begin; i < end; ++i) {
+            const MultiplexIndex::Switch & multiplexorSwitch = switches[switchRefs[i]];
+            const MultiplexIndex::Interval * interval = MultiplexIndex::findInterval(
+                intervals + multiplexorSwitch.intervalBegin,
+                intervals + multiplexorSwitch.intervalEnd,
+                frame.decode(multiplexorSwitch.signal));
+            if (interval) {
+                visitSignals(interval->begin, interval->end);
+                visitSwitches(interval->switchBegin, interval->switchEnd);
+            }
+        }
+    }
+
+    /**
+     * @brief Visit the active signals
+     * @param[in] rootCount Number of signals that are always active
+     * @param[in] rootSwitchCount Number of switches that are always active
+     */
+    void operator()(uint32_t rootCount, uint32_t rootSwitchCount) const {
+        visitSignals(0, rootCount);
+        visitSwitches(0, rootSwitchCount);
+    }
+};
+
+}
+}
@@ -21,12 +21,29 @@
 
 #include <Vector/DBC/Network.h>
 
+#include <Vector/DBC/LayoutValidator.h>
+#include <Vector/DBC/MappedFile.h>
+
 #include <Vector/DBC/Parser.hpp>
 #include <Vector/DBC/Scanner.h>
 
 namespace Vector {
 namespace DBC {
 
+const Message * Network::findMessage(uint32_t id) const {
+    auto it = messages.find(id);
+    if (it == messages.end())
+        return nullptr;
+    return &it->second;
+}
+
+Message * Network::findMessage(uint32_t id) {
+    auto it = messages.find(id);
+    if (it == messages.end())
+        return nullptr;
+    return &it->second;
+}
+
 std::ostream & operator<<(std::ostream & os, const Network & network) {
     /* use english decimal points for floating numbers */
     os.imbue(std::locale("C"));
@@ -475,16 +492,45 @@ std::ostream & operator<<(std::ostream & os, const Network & network) {
     return os;
 }
 
-std::istream & operator>>(std::istream & is, Network & network) {
-    /* Flex scanner */
-    Scanner scanner(is);
-
+/**
+ * @brief Parse a database
+ * @param[in] scanner Flex scanner
+ * @param[inout] network Network
+ */
+static void parse(Scanner & scanner, Network & network) {
     /* Bison parser */
     Parser parser(&scanner, &network);
 
     /* parse */
     network.successfullyParsed = (parser.parse() == 0);
 
+    /* validate signal layouts */
+    if (network.successfullyParsed)
+        validateLayouts(network);
+}
+
+bool Network::load(const std::string & fileName) {
+    MappedFile mappedFile(fileName);
+    if (!mappedFile.isOpen()) {
+        successfullyParsed = false;
+        return false;
+    }
+    return load(mappedFile.data, mappedFile.size);
+}
+
+bool Network::load(const char * data, std::size_t size) {
+    /* Flex scanner */
+    Scanner scanner(data, size);
+
+    parse(scanner, *this);
+    return successfullyParsed;
+}
+
+std::istream & operator>>(std::istream & is, Network & network) {
+    /* Flex scanner */
+    Scanner scanner(is);
+
+    parse(scanner, network);
     return is;
 }
 
@@ -23,6 +23,7 @@
 
 #include <Vector/DBC/platform.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <map>
@@ -35,6 +36,8 @@
 #include <Vector/DBC/AttributeRelation.h>
 #include <Vector/DBC/BitTiming.h>
 #include <Vector/DBC/EnvironmentVariable.h>
+#include <Vector/DBC/LayoutIssue.h>
+#include <Vector/DBC/MemoryUsage.h>
 #include <Vector/DBC/Message.h>
 #include <Vector/DBC/Node.h>
 #include <Vector/DBC/SignalType.h>
@@ -111,8 +114,8 @@ struct VECTOR_DBC_EXPORT Network {
     // moved to Signal (SG) for signals
     // moved to Environment Variable (EV) for environment variables
 
-    /** Attribute Values on Relations (BA_REF) */
-    std::map<std::string, AttributeRelation> attributeRelationValues {};
+    /** Attribute Values on Relations (BA_REL), keyed by name, relation type and related objects */
+    std::map<AttributeRelationKey, AttributeRelation> attributeRelationValues {};
 
     /* Value Descriptions (VAL) */
     // moved to Signals (BO) for signals
@@ -135,6 +138,42 @@ struct VECTOR_DBC_EXPORT Network {
 
     /* Extended Multiplexors (SG_MUL_VAL) */
     // moved to Signal (SG)
+
+    /** Layout issues found by validateLayouts */
+    std::vector<LayoutIssue> layoutIssues {};
+
+    /**
+     * @brief Find a message by identifier
+     * @param[in] id Identifier (with bit 31 set this is extended CAN frame)
+     * @return Message or nullptr if not found
+     */
+    const Message * findMessage(uint32_t id) const;
+
+    /** @copydoc findMessage */
+    Message * findMessage(uint32_t id);
+
+    /**
+     * @brief Estimate the memory usage
+     * @return Bytes per category
+     */
+    MemoryUsage memoryUsage() const;
+
+    /**
+     * @brief Load a database file
+     * @param[in] fileName File Name
+     * @return true if successfully parsed
+     *
+     * The file is mapped into memory and scanned from there, without an istream.
+     */
+    bool load(const std::string & fileName);
+
+    /**
+     * @brief Load a database from memory
+     * @param[in] data Data
+     * @param[in] size Size in bytes
+     * @return true if successfully parsed
+     */
+    bool load(const char * data, std::size_t size);
 };
 
 VECTOR_DBC_EXPORT std::ostream & operator<<(std::ostream & os, const Network & network);
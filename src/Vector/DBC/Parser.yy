@@ -370,6 +370,7 @@ signal
               if (!$multiplexer_indicator.empty()) {
                   $$.multiplexor = Signal::Multiplexor::MultiplexedSignal;
                   $$.multiplexerSwitchValue = std::stoul($multiplexer_indicator);
+                  $$.nestedMultiplexorSwitch = ($multiplexer_indicator.back() == 'M');
               }
               $$.startBit = $start_bit;
               $$.bitSize = $signal_size;
@@ -916,7 +917,7 @@ attribute_value_for_object
           }
         | BA_REL attribute_name BU_EV_REL node_name env_var_name attribute_value SEMICOLON EOL {
               AttributeDefinition & attributeDefinition = network->attributeDefinitions[$attribute_name];
-              AttributeRelation & attributeRelation = network->attributeRelationValues[$attribute_name];
+              AttributeRelation attributeRelation;
               attributeRelation.name = $attribute_name;
               attributeRelation.objectType = AttributeObjectType::ControlUnitEnvironmentVariable;
               attributeRelation.nodeName = $node_name;
@@ -938,10 +939,13 @@ attribute_value_for_object
                   attributeRelation.enumValue = std::stol($attribute_value);
                   break;
               }
+
+              /* replace the value of the same relation */
+              network->attributeRelationValues[AttributeRelationKey(attributeRelation)] = attributeRelation;
           }
         | BA_REL attribute_name BU_BO_REL node_name message_id attribute_value SEMICOLON EOL {
               AttributeDefinition & attributeDefinition = network->attributeDefinitions[$attribute_name];
-              AttributeRelation & attributeRelation = network->attributeRelationValues[$attribute_name];
+              AttributeRelation attributeRelation;
               attributeRelation.name = $attribute_name;
               attributeRelation.objectType = AttributeObjectType::NodeTxMessage;
               attributeRelation.nodeName = $node_name;
@@ -963,10 +967,13 @@ attribute_value_for_object
                   attributeRelation.enumValue = std::stol($attribute_value);
                   break;
               }
+
+              /* replace the value of the same relation */
+              network->attributeRelationValues[AttributeRelationKey(attributeRelation)] = attributeRelation;
           }
         | BA_REL attribute_name BU_SG_REL node_name SG message_id signal_name attribute_value SEMICOLON EOL {
               AttributeDefinition & attributeDefinition = network->attributeDefinitions[$attribute_name];
-              AttributeRelation & attributeRelation = network->attributeRelationValues[$attribute_name];
+              AttributeRelation attributeRelation;
               attributeRelation.name = $attribute_name;
               attributeRelation.objectType = AttributeObjectType::NodeMappedRxSignal;
               attributeRelation.nodeName = $node_name;
@@ -989,6 +996,9 @@ attribute_value_for_object
                   attributeRelation.enumValue = std::stol($attribute_value);
                   break;
               }
+
+              /* replace the value of the same relation */
+              network->attributeRelationValues[AttributeRelationKey(attributeRelation)] = attributeRelation;
           }
         ;
 
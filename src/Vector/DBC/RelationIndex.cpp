@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+#include <Vector/DBC/RelationIndex.h>
+
+namespace Vector {
+namespace DBC {
+
+/** entry of a node or an empty list */
+template<typename T>
+static const std::vector<T> & findEntry(const std::map<std::string, std::vector<T>> & entries, const std::string & node) {
+    static const std::vector<T> empty;
+    auto entry = entries.find(node);
+    if (entry == entries.end())
+        return empty;
+    return entry->second;
+}
+
+RelationIndex::RelationIndex(const Network & network) :
+    network(network) {
+}
+
+const std::vector<const Message *> & RelationIndex::messagesTransmittedBy(const std::string & node) {
+    if (!transmittedMessagesBuilt) {
+        for (const auto & message : network.messages) {
+            if (!message.second.transmitter.empty())
+                transmittedMessages[message.second.transmitter].push_back(&message.second);
+            for (const std::string & transmitter : message.second.transmitters) {
+                /* the transmitter is usually listed in BO_TX_BU as well */
+                if (transmitter.empty() || (transmitter == message.second.transmitter))
+                    continue;
+                transmittedMessages[transmitter].push_back(&message.second);
+            }
+        }
+        transmittedMessagesBuilt = true;
+    }
+    return findEntry(transmittedMessages, node);
+}
+
+/** build receivedMessages and receivedSignals */
+static void buildReceivedSignals(const Network & network,
+                                 std::map<std::string, std::vector<const Message *>> & receivedMessages,
+                                 std::map<std::string, std::vector<RelationIndex::SignalReference>> & receivedSignals) {
+    for (const auto & message : network.messages) {
+        for (const auto & signal : message.second.signals) {
+            for (const std::string & receiver : signal.second.receivers) {
+                if (receiver.empty())
+                    continue;
+                receivedSignals[receiver].push_back({ &message.second, &signal.second });
+
+                /* signals are grouped by message, so a message is the last entry if it was added before */
+                std::vector<const Message *> & messages = receivedMessages[receiver];
+                if (messages.empty() || (messages.back() != &message.second))
+                    messages.push_back(&message.second);
+            }
+        }
+    }
+}
+
+const std::vector<const Message *> & RelationIndex::messagesReceivedBy(const std::string & node) {
+    if (!receivedSignalsBuilt) {
+        buildReceivedSignals(network, receivedMessages, receivedSignals);
+        receivedSignalsBuilt = true;
+    }
+    return findEntry(receivedMessages, node);
+}
+
+const std::vector<RelationIndex::SignalReference> & RelationIndex::signalsReceivedBy(const std::string & node) {
+    if (!receivedSignalsBuilt) {
+        buildReceivedSignals(network, receivedMessages, receivedSignals);
+        receivedSignalsBuilt = true;
+    }
+    return findEntry(receivedSignals, node);
+}
+
+const std::vector<const EnvironmentVariable *> & RelationIndex::environmentVariablesAccessedBy(const std::string & node) {
+    if (!accessedEnvironmentVariablesBuilt) {
+        for (const auto & environmentVariable : network.environmentVariables) {
+            for (const std::string & accessNode : environmentVariable.second.accessNodes) {
+                if (!accessNode.empty())
+                    accessedEnvironmentVariables[accessNode].push_back(&environmentVariable.second);
+            }
+        }
+        accessedEnvironmentVariablesBuilt = true;
+    }
+    return findEntry(accessedEnvironmentVariables, node);
+}
+
+void RelationIndex::clear() {
+    transmittedMessages.clear();
+    transmittedMessagesBuilt = false;
+    receivedMessages.clear();
+    receivedSignals.clear();
+    receivedSignalsBuilt = false;
+    accessedEnvironmentVariables.clear();
+    accessedEnvironmentVariablesBuilt = false;
+}
+
+}
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <Vector/DBC/Network.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Relation Index
+ *
+ * Reverse indices from node names to the messages, signals and
+ * environment variables of a network that refer to them.
+ *
+ * Each index is built on its first query and kept until clear is called.
+ * The network must outlive the index, call clear after changing it.
+ *
+ * @note Queries build indices, so they must not be called concurrently.
+ */
+struct VECTOR_DBC_EXPORT RelationIndex {
+    /** Signal and the message it belongs to */
+    struct SignalReference {
+        /** Message */
+        const Message * message;
+
+        /** Signal */
+        const Signal * signal;
+    };
+
+    /**
+     * @brief Constructor
+     * @param[in] network Network
+     */
+    explicit RelationIndex(const Network & network);
+
+    /** Network */
+    const Network & network;
+
+    /** Messages per transmitter (Message::transmitter and BO_TX_BU), ordered by identifier */
+    std::map<std::string, std::vector<const Message *>> transmittedMessages {};
+
+    /** transmittedMessages is built */
+    bool transmittedMessagesBuilt { false };
+
+    /** Messages with at least one received signal per receiver, ordered by identifier */
+    std::map<std::string, std::vector<const Message *>> receivedMessages {};
+
+    /** Signals per receiver, ordered by message identifier and signal name */
+    std::map<std::string, std::vector<SignalReference>> receivedSignals {};
+
+    /** receivedMessages and receivedSignals are built */
+    bool receivedSignalsBuilt { false };
+
+    /** Environment Variables per access node, ordered by name */
+    std::map<std::string, std::vector<const EnvironmentVariable *>> accessedEnvironmentVariables {};
+
+    /** accessedEnvironmentVariables is built */
+    bool accessedEnvironmentVariablesBuilt { false };
+
+    /**
+     * @brief Messages transmitted by a node
+     * @param[in] node Node Name
+     * @return Messages (empty if none)
+     */
+    const std::vector<const Message *> & messagesTransmittedBy(const std::string & node);
+
+    /**
+     * @brief Messages with signals received by a node
+     * @param[in] node Node Name
+     * @return Messages (empty if none)
+     */
+    const std::vector<const Message *> & messagesReceivedBy(const std::string & node);
+
+    /**
+     * @brief Signals received by a node
+     * @param[in] node Node Name
+     * @return Signals (empty if none)
+     */
+    const std::vector<SignalReference> & signalsReceivedBy(const std::string & node);
+
+    /**
+     * @brief Environment variables accessed by a node
+     * @param[in] node Node Name
+     * @return Environment Variables (empty if none)
+     */
+    const std::vector<const EnvironmentVariable *> & environmentVariablesAccessedBy(const std::string & node);
+
+    /** Drop all indices, e.g. after the network was changed */
+    void clear();
+};
+
+}
+}
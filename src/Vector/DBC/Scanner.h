@@ -2,6 +2,9 @@
 
 #include <Vector/DBC/platform.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <iostream>
 
 #if !defined(yyFlexLexerOnce)
@@ -10,18 +13,10 @@
 
 #define YY_DECL Vector::DBC::Parser::symbol_type Vector::DBC::Scanner::yylex(const Vector::DBC::Parser::location_type & loc)
 
+/* advance the column only, rules that can match newlines call newLines() */
 #define YY_USER_ACTION \
-    location.begin.line = location.end.line; \
-    location.begin.column = location.end.column; \
-    for (int i = 0; yytext[i] != '\0'; i++) { \
-        if(yytext[i] == '\n') { \
-            location.end.line++; \
-            location.end.column = 0; \
-        } \
-        else { \
-            location.end.column++; \
-        } \
-    }
+    location.begin = location.end; \
+    location.end.column += yyleng;
 
 #include <Vector/DBC/Parser.hpp>
 
@@ -32,6 +27,12 @@ namespace DBC {
  * @brief Lex scanner class
  *
  * This contains the converter-specific Flex Lexer class.
+ *
+ * Locations are advanced once per token, only tokens that can contain
+ * newlines are searched for them. Tokens are still copied from yytext
+ * into std::string semantic values: yytext points into the flex buffer,
+ * which is refilled while the parser holds its lookahead, so it can't
+ * be handed out as a view. Scanning is not vectorized.
  */
 class Scanner : public yyFlexLexer {
   public:
@@ -40,6 +41,38 @@ class Scanner : public yyFlexLexer {
         location()
     { }
 
+    /**
+     * scanner on a memory buffer
+     *
+     * @param data data, has to outlive the scanner
+     * @param size size in bytes
+     */
+    Scanner(const char * data, std::size_t size) :
+        yyFlexLexer(),
+        location(),
+        fromMemory(true),
+        input(data),
+        inputEnd(data + size)
+    { }
+
+    /**
+     * read input into the flex buffer
+     *
+     * @param buf flex buffer
+     * @param max_size size of flex buffer
+     * @return number of bytes read, 0 on end of input
+     */
+    int LexerInput(char * buf, int max_size) override {
+        if (!fromMemory)
+            return yyFlexLexer::LexerInput(buf, max_size);
+        std::size_t size = std::min(static_cast<std::size_t>(max_size), static_cast<std::size_t>(inputEnd - input));
+        if (size == 0)
+            return 0;
+        std::memcpy(buf, input, size);
+        input += size;
+        return static_cast<int>(size);
+    }
+
     /**
      * lexer function
      *
@@ -48,8 +81,33 @@ class Scanner : public yyFlexLexer {
      */
     Parser::symbol_type yylex(const Parser::location_type & loc);
 
+    /**
+     * advance the location over the newlines of the current token
+     *
+     * The column restarts after the last newline.
+     */
+    void newLines() {
+        const char * end = yytext + yyleng;
+        const char * lineStart = nullptr;
+        for (const char * newLine = yytext; (newLine = static_cast<const char *>(std::memchr(newLine, '\n', end - newLine))) != nullptr; ++newLine) {
+            location.end.line++;
+            lineStart = newLine + 1;
+        }
+        if (lineStart != nullptr)
+            location.end.column = end - lineStart;
+    }
+
     /** location */
     Parser::location_type location;
+
+    /** reading from a memory buffer instead of the istream */
+    bool fromMemory { false };
+
+    /** memory buffer read position (may be nullptr for an empty buffer) */
+    const char * input {};
+
+    /** memory buffer end */
+    const char * inputEnd {};
 };
 
 }
@@ -8,11 +8,14 @@
 
     // debug options
     // %option backup
-%option debug
-%option perf-report
+    // %option debug
+    // %option perf-report
     // %option trace
     // %option verbose
 
+    // performance options
+%option full
+
     // standard options
 %option nodefault
 %option nounput
@@ -44,12 +47,13 @@ EXPONENT_PART           ([Ee][+-]?{DIGIT}+)
     BEGIN(INITIAL);
     return Vector::DBC::Parser::make_BS(loc); }
 <NS>{NONDIGIT}+ {
-    return Vector::DBC::Parser::make_NS_VALUE(yytext, loc); }
+    return Vector::DBC::Parser::make_NS_VALUE(std::string(yytext, yyleng), loc); }
 <NS>":" {
     return Vector::DBC::Parser::make_COLON(loc); }
 <NS>([ ]*[\r\n]+)+ {
+    newLines();
     return Vector::DBC::Parser::make_EOL(loc); }
-<NS>[ \t] {
+<NS>[ \t]+ {
     }
 
     /* 5 Bit Timing Definition */
@@ -194,29 +198,30 @@ EXPONENT_PART           ([Ee][+-]?{DIGIT}+)
 
     /* 2 General Definitions */
 {DIGIT}+ {
-    return Vector::DBC::Parser::make_UNSIGNED_INTEGER(yytext, loc); }
+    return Vector::DBC::Parser::make_UNSIGNED_INTEGER(std::string(yytext, yyleng), loc); }
 [-+]?{DIGIT}+ {
-    return Vector::DBC::Parser::make_SIGNED_INTEGER(yytext, loc); }
+    return Vector::DBC::Parser::make_SIGNED_INTEGER(std::string(yytext, yyleng), loc); }
 [-+]?{DIGIT}*"."?{DIGIT}+{EXPONENT_PART}? {
-    return Vector::DBC::Parser::make_DOUBLE(yytext, loc); }
+    return Vector::DBC::Parser::make_DOUBLE(std::string(yytext, yyleng), loc); }
 \"(\\.|[^\\"])*\" {
-    std::string str(yytext);
-    str.erase(0, 1);
-    str.erase(str.size() - 1);
-    return Vector::DBC::Parser::make_CHAR_STRING(str, loc); }
+    /* strings can span lines */
+    newLines();
+    return Vector::DBC::Parser::make_CHAR_STRING(std::string(yytext + 1, yyleng - 2), loc); }
 {NONDIGIT}({NONDIGIT}|{DIGIT})* {
-    return Vector::DBC::Parser::make_DBC_IDENTIFIER(yytext, loc); }
+    return Vector::DBC::Parser::make_DBC_IDENTIFIER(std::string(yytext, yyleng), loc); }
 
     /* comments */
 "//".*[\r\n]+ {
+    newLines();
     }
 
     /* end of line */
 ([ ]*[\r\n]+)+ {
+    newLines();
     return Vector::DBC::Parser::make_EOL(loc); }
 
     /* whitespace */
-[ \t] {
+[ \t]+ {
     }
 
     /* yet unmatched characters */
@@ -44,8 +44,13 @@ double Signal::minimumRawValue() const {
     switch (extendedValueType) {
     case ExtendedValueType::Undefined:
     case ExtendedValueType::Integer:
+        /* safety check */
+        if ((bitSize == 0) || (bitSize > 64))
+            break;
+
+        /* ldexp instead of shift, as shifts overflow above 32 bits */
         if (valueType == ValueType::Signed) {
-            minimumRawValue = -(2 << (bitSize - 2)); // bitSize-- because shift instead of pow
+            minimumRawValue = -std::ldexp(1.0, bitSize - 1);
         } else
             minimumRawValue = 0.0;
         break;
@@ -67,10 +72,15 @@ double Signal::maximumRawValue() const {
     switch (extendedValueType) {
     case ExtendedValueType::Undefined:
     case ExtendedValueType::Integer:
+        /* safety check */
+        if ((bitSize == 0) || (bitSize > 64))
+            break;
+
+        /* ldexp instead of shift, as shifts overflow above 32 bits */
         if (valueType == ValueType::Signed) {
-            maximumRawValue = (2 << (bitSize - 2)) - 1; // bitSize-- because shift instead of pow
+            maximumRawValue = std::ldexp(1.0, bitSize - 1) - 1.0;
         } else {
-            maximumRawValue = (2 << (bitSize - 1)) - 1; // bitSize-- because shift instead of pow
+            maximumRawValue = std::ldexp(1.0, bitSize) - 1.0;
         }
         break;
 
@@ -85,95 +95,53 @@ double Signal::maximumRawValue() const {
     return maximumRawValue;
 }
 
-uint64_t Signal::decode(std::vector<uint8_t> & data) const {
-    /* safety check */
-    if (bitSize == 0)
-        return 0;
-
-    /* copy bits */
-    uint64_t retVal = 0;
-    if (byteOrder == ByteOrder::BigEndian) {
-        /* start with MSB */
-        unsigned int srcBit = startBit;
-        unsigned int dstBit = bitSize - 1;
-        for (uint32_t i = 0; i < bitSize; ++i) {
-            /* copy bit */
-            if (data[srcBit / 8] & (1 << (srcBit % 8)))
-                retVal |= (1ULL << dstBit);
-
-            /* calculate next position */
-            if ((srcBit % 8) == 0)
-                srcBit += 15;
-            else
-                --srcBit;
-            --dstBit;
-        }
-    } else {
-        /* start with LSB */
-        unsigned int srcBit = startBit;
-        unsigned int dstBit = 0;
-        for (uint32_t i = 0; i < bitSize; ++i) {
-            /* copy bit */
-            if (data[srcBit / 8] & (1 << (srcBit % 8)))
-                retVal |= (1ULL << dstBit);
-
-            /* calculate next position */
-            ++srcBit;
-            ++dstBit;
-        }
-    }
+SignalConversion Signal::conversion() const {
+    SignalConversion conversion;
+    switch (extendedValueType) {
+    case ExtendedValueType::Undefined:
+    case ExtendedValueType::Integer:
+        if (valueType == ValueType::Signed)
+            conversion.rawType = SignalConversion::RawType::Signed;
+        else
+            conversion.rawType = SignalConversion::RawType::Unsigned;
+        break;
 
-    /* if signed, then fill all bits above MSB with 1 */
-    if (valueType == ValueType::Signed) {
-        if (retVal & (1 << (bitSize - 1))) {
-            for (auto i = bitSize; i < 64; ++i)
-                retVal |= (1ULL << i);
-        }
+    case ExtendedValueType::Float:
+        conversion.rawType = SignalConversion::RawType::Float;
+        break;
+
+    case ExtendedValueType::Double:
+        conversion.rawType = SignalConversion::RawType::Double;
+        break;
     }
+    conversion.factor = factor;
+    conversion.offset = offset;
+    conversion.mask = (bitSize >= 64) ? ~0ULL : ((1ULL << bitSize) - 1);
+    return conversion;
+}
+
+uint64_t Signal::decode(const std::vector<uint8_t> & data) const {
+    return layout().decode(data.data(), data.size());
+}
 
-    return retVal;
+uint64_t Signal::decode(const uint8_t * data, std::size_t size) const {
+    return layout().decode(data, size);
+}
+
+double Signal::decodePhysical(const std::vector<uint8_t> & data) const {
+    return conversion().physicalValue(layout().decode(data.data(), data.size()));
+}
+
+double Signal::decodePhysical(const uint8_t * data, std::size_t size) const {
+    return conversion().physicalValue(layout().decode(data, size));
 }
 
 void Signal::encode(std::vector<uint8_t> & data, uint64_t rawValue) const {
-    /* safety check */
-    if (bitSize == 0)
-        return;
-
-    /* copy bits */
-    if (byteOrder == ByteOrder::BigEndian) {
-        /* start with MSB */
-        unsigned int srcBit = startBit;
-        unsigned int dstBit = bitSize - 1;
-        for (uint32_t i = 0; i < bitSize; ++i) {
-            /* copy bit */
-            if (rawValue & (1ULL << dstBit))
-                data[srcBit / 8] |= (1 << (srcBit % 8));
-            else
-                data[srcBit / 8] &= ~(1 << (srcBit % 8));
-
-            /* calculate next position */
-            if ((srcBit % 8) == 0)
-                srcBit += 15;
-            else
-                --srcBit;
-            --dstBit;
-        }
-    } else {
-        /* start with LSB */
-        unsigned int srcBit = startBit;
-        unsigned int dstBit = 0;
-        for (uint32_t i = 0; i < bitSize; ++i) {
-            /* copy bit */
-            if (rawValue & (1ULL << dstBit))
-                data[srcBit / 8] |= (1 << (srcBit % 8));
-            else
-                data[srcBit / 8] &= ~(1 << (srcBit % 8));
-
-            /* calculate next position */
-            ++srcBit;
-            ++dstBit;
-        }
-    }
+    layout().encode(data.data(), data.size(), rawValue);
+}
+
+void Signal::encode(uint8_t * data, std::size_t size, uint64_t rawValue) const {
+    layout().encode(data, size, rawValue);
 }
 
 std::ostream & operator<<(std::ostream & os, const Signal & signal) {
@@ -187,6 +155,8 @@ std::ostream & operator<<(std::ostream & os, const Signal & signal) {
         break;
     case Signal::Multiplexor::MultiplexedSignal:
         os << 'm' << signal.multiplexerSwitchValue;
+        if (signal.nestedMultiplexorSwitch)
+            os << 'M';
         break;
     case Signal::Multiplexor::MultiplexorSwitch:
         os << 'M';
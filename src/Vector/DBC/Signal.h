@@ -23,6 +23,7 @@
 
 #include <Vector/DBC/platform.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <ostream>
@@ -33,6 +34,8 @@
 #include <Vector/DBC/Attribute.h>
 #include <Vector/DBC/ByteOrder.h>
 #include <Vector/DBC/ExtendedMultiplexor.h>
+#include <Vector/DBC/SignalConversion.h>
+#include <Vector/DBC/SignalLayout.h>
 #include <Vector/DBC/ValueDescriptions.h>
 #include <Vector/DBC/ValueType.h>
 
@@ -66,6 +69,9 @@ struct VECTOR_DBC_EXPORT Signal {
     /** Multiplexer Switch Value */
     uint32_t multiplexerSwitchValue {};
 
+    /** Multiplexed Signal is a Multiplexor Switch as well (m<value>M, nested multiplexing) */
+    bool nestedMultiplexorSwitch { false };
+
     /** Start Bit */
     uint32_t startBit {};
 
@@ -163,6 +169,27 @@ struct VECTOR_DBC_EXPORT Signal {
      */
     double maximumRawValue() const;
 
+    /**
+     * @brief Get the precompiled extraction plan
+     * @return Signal Layout
+     *
+     * Compiles startBit, bitSize, byteOrder and valueType into a layout.
+     * For repeated decoding keep it, as MessageDecoder, CompiledMessage
+     * and BatchDecoder do.
+     */
+    SignalLayout layout() const {
+        return SignalLayout(startBit, bitSize, byteOrder, valueType);
+    }
+
+    /**
+     * @brief Get the precompiled raw to physical value conversion
+     * @return Signal Conversion
+     *
+     * Compiles valueType, extendedValueType, bitSize, factor and offset into a conversion,
+     * that interprets IEEE float/double signals (SIG_VALTYPE) correctly.
+     */
+    SignalConversion conversion() const;
+
     /**
      * @brief Decodes/Extracts a signal from the message data
      * @param[in] data Data
@@ -172,7 +199,44 @@ struct VECTOR_DBC_EXPORT Signal {
      *
      * @note Multiplexors are not taken into account.
      */
-    uint64_t decode(std::vector<uint8_t> & data) const;
+    uint64_t decode(const std::vector<uint8_t> & data) const;
+
+    /**
+     * @brief Decodes/Extracts a signal from the message data
+     * @param[in] data Data
+     * @param[in] size Size of data in bytes
+     * @return Raw signal value
+     *
+     * Decodes/Extracts a signal directly from a receive buffer.
+     *
+     * @note Multiplexors are not taken into account.
+     */
+    uint64_t decode(const uint8_t * data, std::size_t size) const;
+
+    /**
+     * @brief Decodes a signal from the message data into its physical value
+     * @param[in] data Data
+     * @return Physical signal value
+     *
+     * Integer signals are sign extended and scaled by factor/offset,
+     * IEEE float/double signals are reinterpreted before scaling.
+     *
+     * @note Multiplexors are not taken into account.
+     */
+    double decodePhysical(const std::vector<uint8_t> & data) const;
+
+    /**
+     * @brief Decodes a signal from the message data into its physical value
+     * @param[in] data Data
+     * @param[in] size Size of data in bytes
+     * @return Physical signal value
+     *
+     * Integer signals are sign extended and scaled by factor/offset,
+     * IEEE float/double signals are reinterpreted before scaling.
+     *
+     * @note Multiplexors are not taken into account.
+     */
+    double decodePhysical(const uint8_t * data, std::size_t size) const;
 
     /**
      * @brief Encodes a signal into the message data
@@ -184,6 +248,18 @@ struct VECTOR_DBC_EXPORT Signal {
      * @note Multiplexors are not taken into account.
      */
     void encode(std::vector<uint8_t> & data, uint64_t rawValue) const;
+
+    /**
+     * @brief Encodes a signal into the message data
+     * @param[inout] data Data
+     * @param[in] size Size of data in bytes
+     * @param[in] rawValue Raw signal value
+     *
+     * Encode a signal directly into a transmit buffer.
+     *
+     * @note Multiplexors are not taken into account.
+     */
+    void encode(uint8_t * data, std::size_t size, uint64_t rawValue) const;
 };
 
 std::ostream & operator<<(std::ostream & os, const Signal & signal);
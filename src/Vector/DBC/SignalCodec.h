@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstdint>
+
+#include <Vector/DBC/ByteOrder.h>
+#include <Vector/DBC/ValueType.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Signal Codec
+ *
+ * Compile-time specialized variant of Signal::decode/encode for signals,
+ * whose layout is known at build time. All layout arithmetic is resolved
+ * at compile time, so decode/encode inline to a few loads, shifts and masks.
+ *
+ * The data has to provide byteOffset + byteCount bytes.
+ *
+ * @tparam StartBit Start Bit
+ * @tparam BitSize Bit Size (1..64)
+ * @tparam Order Byte Order
+ * @tparam Type Value Type
+ */
+template<uint32_t StartBit, uint32_t BitSize, ByteOrder Order, ValueType Type>
+struct SignalCodec {
+    static_assert((BitSize >= 1) && (BitSize <= 64), "BitSize must be in range 1..64");
+
+    /** Window is loaded as big endian word (Motorola) */
+    static constexpr bool byteSwap = (Order == ByteOrder::BigEndian);
+
+    /** Position of the MSB counted from the top of the window (big endian only) */
+    static constexpr uint32_t msb = 7 - (StartBit % 8);
+
+    /** First byte of the signal within the message data */
+    static constexpr uint32_t byteOffset = StartBit / 8;
+
+    /** Number of bytes the signal spans */
+    static constexpr uint32_t byteCount = byteSwap ? (msb + BitSize + 7) / 8 : (StartBit % 8 + BitSize + 7) / 8;
+
+    /** Position of the LSB within the window (within the ninth byte for big endian nine byte spans) */
+    static constexpr uint32_t shift =
+        !byteSwap ? StartBit % 8 :
+        (msb + BitSize <= 64) ? 64 - msb - BitSize : 72 - msb - BitSize;
+
+    /** Mask of the raw value bits */
+    static constexpr uint64_t mask = (BitSize == 64) ? ~0ULL : ((1ULL << (BitSize % 64)) - 1);
+
+    /** Bits above the MSB that are set for negative values (0 if unsigned) */
+    static constexpr uint64_t signExtension = (Type == ValueType::Signed) ? ~mask : 0;
+
+    /**
+     * @brief Decodes/Extracts the signal from the message data
+     * @param[in] data Data
+     * @return Raw signal value
+     */
+    static constexpr uint64_t decode(const uint8_t * data) {
+        /* load window */
+        uint64_t window = 0;
+        for (uint32_t i = 0; (i < byteCount) && (i < 8); ++i)
+            window |= uint64_t(data[byteOffset + i]) << (byteSwap ? 56 - 8 * i : 8 * i);
+
+        /* extract */
+        uint64_t retVal = 0;
+        if (byteCount <= 8)
+            retVal = window >> shift;
+        else if (byteSwap)
+            retVal = (window << ((8 - shift) % 64)) | (data[byteOffset + 8] >> shift);
+        else
+            retVal = (window >> shift) | (uint64_t(data[byteOffset + 8]) << ((64 - shift) % 64));
+        retVal &= mask;
+
+        /* if signed and MSB is set, then fill all bits above MSB with 1 */
+        if (retVal & (signExtension >> 1))
+            retVal |= signExtension;
+
+        return retVal;
+    }
+
+    /**
+     * @brief Encodes the signal into the message data
+     * @param[inout] data Data
+     * @param[in] rawValue Raw signal value
+     */
+    static constexpr void encode(uint8_t * data, uint64_t rawValue) {
+        rawValue &= mask;
+
+        /* window and ninth byte masks/values */
+        uint64_t windowMask = mask << shift;
+        uint64_t windowValue = rawValue << shift;
+        uint8_t lastMask = 0;
+        uint8_t lastValue = 0;
+        if (byteCount > 8) {
+            if (byteSwap) {
+                windowMask = mask >> ((8 - shift) % 64);
+                windowValue = rawValue >> ((8 - shift) % 64);
+                lastMask = uint8_t(0xFF << shift);
+                lastValue = uint8_t(rawValue << shift);
+            } else {
+                lastMask = uint8_t(mask >> ((64 - shift) % 64));
+                lastValue = uint8_t(rawValue >> ((64 - shift) % 64));
+            }
+        }
+
+        /* read, modify, write the spanned bytes */
+        for (uint32_t i = 0; (i < byteCount) && (i < 8); ++i) {
+            const uint32_t position = byteSwap ? 56 - 8 * i : 8 * i;
+            const uint8_t byteMask = uint8_t(windowMask >> position);
+            data[byteOffset + i] = uint8_t((data[byteOffset + i] & ~byteMask) | (uint8_t(windowValue >> position) & byteMask));
+        }
+        if (byteCount > 8)
+            data[byteOffset + 8] = uint8_t((data[byteOffset + 8] & ~lastMask) | lastValue);
+    }
+};
+
+template<uint32_t StartBit, uint32_t BitSize, ByteOrder Order, ValueType Type>
+constexpr bool SignalCodec<StartBit, BitSize, Order, Type>::byteSwap;
+
+template<uint32_t StartBit, uint32_t BitSize, ByteOrder Order, ValueType Type>
+constexpr uint32_t SignalCodec<StartBit, BitSize, Order, Type>::msb;
+
+template<uint32_t StartBit, uint32_t BitSize, ByteOrder Order, ValueType Type>
+constexpr uint32_t SignalCodec<StartBit, BitSize, Order, Type>::byteOffset;
+
+template<uint32_t StartBit, uint32_t BitSize, ByteOrder Order, ValueType Type>
+constexpr uint32_t SignalCodec<StartBit, BitSize, Order, Type>::byteCount;
+
+template<uint32_t StartBit, uint32_t BitSize, ByteOrder Order, ValueType Type>
+constexpr uint32_t SignalCodec<StartBit, BitSize, Order, Type>::shift;
+
+template<uint32_t StartBit, uint32_t BitSize, ByteOrder Order, ValueType Type>
+constexpr uint64_t SignalCodec<StartBit, BitSize, Order, Type>::mask;
+
+template<uint32_t StartBit, uint32_t BitSize, ByteOrder Order, ValueType Type>
+constexpr uint64_t SignalCodec<StartBit, BitSize, Order, Type>::signExtension;
+
+}
+}
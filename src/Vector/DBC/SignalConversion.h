@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Signal Conversion
+ *
+ * Precompiled raw to physical value conversion of a signal, based on
+ * valueType, extendedValueType, factor and offset.
+ */
+struct VECTOR_DBC_EXPORT SignalConversion {
+    /** Interpretation of the raw value bits */
+    enum class RawType : uint8_t {
+        /** Unsigned Integer */
+        Unsigned,
+
+        /** Signed Integer (sign extended) */
+        Signed,
+
+        /** IEEE Float (lower 32 bits) */
+        Float,
+
+        /** IEEE Double */
+        Double
+    };
+
+    /** @copydoc RawType */
+    RawType rawType { RawType::Unsigned };
+
+    /** Factor */
+    double factor { 1.0 };
+
+    /** Offset */
+    double offset {};
+
+    /** Mask of the raw value bits (SignalLayout::mask), limits integer raw values */
+    uint64_t mask { ~0ULL };
+
+    /**
+     * @brief Convert the raw value bits into the raw value
+     * @param[in] rawValue Raw signal value as returned by decode
+     * @return Raw Value
+     */
+    double rawValue(uint64_t rawValue) const {
+        switch (rawType) {
+        case RawType::Signed:
+            return static_cast<double>(static_cast<int64_t>(rawValue));
+        case RawType::Float: {
+            uint32_t bits = static_cast<uint32_t>(rawValue);
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+        case RawType::Double: {
+            double value;
+            std::memcpy(&value, &rawValue, sizeof(value));
+            return value;
+        }
+        case RawType::Unsigned:
+            break;
+        }
+        return static_cast<double>(rawValue);
+    }
+
+    /**
+     * @brief Convert the raw value bits into the physical value
+     * @param[in] rawValue Raw signal value as returned by decode
+     * @return Physical Value
+     *
+     * physicalValue = rawValue * factor + offset
+     */
+    double physicalValue(uint64_t rawValue) const {
+        return this->rawValue(rawValue) * factor + offset;
+    }
+
+    /**
+     * @brief Convert the raw value into the raw value bits
+     * @param[in] rawValue Raw Value
+     * @return Raw signal value as taken by encode
+     *
+     * Integers are rounded to nearest and saturated to the range of
+     * the raw value bits (mask), e.g. 0..255 or -128..127 for 8 bits.
+     */
+    uint64_t rawBits(double rawValue) const {
+        switch (rawType) {
+        case RawType::Signed: {
+            /* 2^(bitSize-1), exact also if mask isn't representable as double */
+            const double limit = static_cast<double>(mask >> 1) + 1.0;
+            rawValue = std::round(rawValue);
+            if (!(rawValue >= -limit))
+                return ~(mask >> 1);
+            if (rawValue >= limit)
+                return mask >> 1;
+            return static_cast<uint64_t>(static_cast<int64_t>(rawValue));
+        }
+        case RawType::Float: {
+            float value = static_cast<float>(rawValue);
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+        case RawType::Double: {
+            uint64_t bits;
+            std::memcpy(&bits, &rawValue, sizeof(bits));
+            return bits;
+        }
+        case RawType::Unsigned:
+            break;
+        }
+
+        /* 2^bitSize */
+        const double limit = static_cast<double>(mask) + 1.0;
+        rawValue = std::round(rawValue);
+        if (!(rawValue >= 0.0))
+            return 0;
+        if (rawValue >= limit)
+            return mask;
+        return static_cast<uint64_t>(rawValue);
+    }
+
+    /**
+     * @brief Convert the physical value into the raw value bits
+     * @param[in] physicalValue Physical Value
+     * @return Raw signal value as taken by encode
+     *
+     * rawValue = (physicalValue - offset) / factor
+     */
+    uint64_t physicalToRawBits(double physicalValue) const {
+        return rawBits((physicalValue - offset) / factor);
+    }
+};
+
+}
+}
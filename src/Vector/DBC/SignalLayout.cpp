@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <algorithm>
+
+#include <Vector/DBC/SignalLayout.h>
+
+namespace Vector {
+namespace DBC {
+
+SignalLayout::SignalLayout(uint32_t startBit, uint32_t bitSize, ByteOrder byteOrder, ValueType valueType) {
+    /* safety check */
+    if ((bitSize == 0) || (bitSize > 64))
+        return;
+
+    byteOffset = startBit / 8;
+    byteSwap = (byteOrder == ByteOrder::BigEndian);
+    mask = (bitSize == 64) ? ~0ULL : ((1ULL << bitSize) - 1);
+    valueSigned = (valueType == ValueType::Signed);
+    if (valueSigned)
+        signExtension = ~mask;
+
+    if (byteSwap) {
+        /* startBit is the MSB, counted from the top of the window */
+        unsigned int msb = 7 - (startBit % 8);
+        byteCount = (msb + bitSize + 7) / 8;
+        if (msb + bitSize <= 64)
+            shift = 64 - msb - bitSize;
+        else
+            shift = 72 - msb - bitSize;
+    } else {
+        /* startBit is the LSB */
+        shift = startBit % 8;
+        byteCount = (shift + bitSize + 7) / 8;
+    }
+}
+
+uint64_t SignalLayout::decode(const uint8_t * data, std::size_t size) const {
+    /* safety check */
+    if (byteCount == 0)
+        return 0;
+
+    uint64_t retVal;
+    std::size_t origin;
+    unsigned int windowShift;
+    if (window(size, origin, windowShift)) {
+        /* single window load */
+        return decodeWindow(data, origin, windowShift);
+    }
+
+    /* copy partially available spans into a zero padded buffer */
+    uint8_t buffer[9] {};
+    const uint8_t * src = data + byteOffset;
+    if (byteOffset + std::size_t(byteCount > 8 ? 9 : 8) > size) {
+        if (byteOffset < size)
+            std::copy_n(src, std::min<std::size_t>(byteCount, size - byteOffset), buffer);
+        src = buffer;
+    }
+
+    /* load and extract */
+    if (byteSwap) {
+        retVal = loadBigEndian(src);
+        if (byteCount > 8)
+            retVal = (retVal << (8 - shift)) | (src[8] >> shift);
+        else
+            retVal >>= shift;
+    } else {
+        retVal = loadLittleEndian(src) >> shift;
+        if (byteCount > 8)
+            retVal |= uint64_t(src[8]) << (64 - shift);
+    }
+    retVal &= mask;
+
+    /* if signed and MSB is set, then fill all bits above MSB with 1 */
+    if (retVal & (signExtension >> 1))
+        retVal |= signExtension;
+
+    return retVal;
+}
+
+void SignalLayout::encode(uint8_t * data, std::size_t size, uint64_t rawValue) const {
+    /* safety check */
+    if (byteCount == 0)
+        return;
+    rawValue &= mask;
+
+    std::size_t origin;
+    unsigned int windowShift;
+    if (window(size, origin, windowShift)) {
+        /* single window read, modify, write */
+        uint64_t windowMask = mask << windowShift;
+        uint64_t windowValue = rawValue << windowShift;
+        if (byteSwap)
+            storeBigEndian(data + origin, (loadBigEndian(data + origin) & ~windowMask) | windowValue);
+        else
+            storeLittleEndian(data + origin, (loadLittleEndian(data + origin) & ~windowMask) | windowValue);
+        return;
+    }
+
+    /* calculate masks and values for window and ninth byte */
+    uint64_t windowMask = mask << shift;
+    uint64_t windowValue = rawValue << shift;
+    uint8_t lastMask = 0;
+    uint8_t lastValue = 0;
+    if (byteCount > 8) {
+        if (byteSwap) {
+            windowMask = mask >> (8 - shift);
+            windowValue = rawValue >> (8 - shift);
+            lastMask = uint8_t(0xFF << shift);
+            lastValue = uint8_t(rawValue << shift);
+        } else {
+            lastMask = uint8_t(mask >> (64 - shift));
+            lastValue = uint8_t(rawValue >> (64 - shift));
+        }
+    }
+
+    /* operate on a buffer if the span is only partially available */
+    uint8_t buffer[9] {};
+    uint8_t * dst = data + byteOffset;
+    std::size_t available = 0;
+    if (byteOffset + std::size_t(byteCount > 8 ? 9 : 8) > size) {
+        if (byteOffset < size)
+            available = std::min<std::size_t>(byteCount, size - byteOffset);
+        std::copy_n(dst, available, buffer);
+        dst = buffer;
+    }
+
+    /* read, modify, write */
+    if (byteSwap)
+        storeBigEndian(dst, (loadBigEndian(dst) & ~windowMask) | windowValue);
+    else
+        storeLittleEndian(dst, (loadLittleEndian(dst) & ~windowMask) | windowValue);
+    if (byteCount > 8)
+        dst[8] = (dst[8] & ~lastMask) | lastValue;
+
+    /* copy back */
+    if (dst == buffer)
+        std::copy_n(buffer, available, data + byteOffset);
+}
+
+}
+}
@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <Vector/DBC/ByteOrder.h>
+#include <Vector/DBC/ValueType.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Signal Layout
+ *
+ * Precompiled extraction plan of a signal. The signal is located in a
+ * 64-bit window that is loaded from byteOffset onwards, either as little
+ * endian (Intel) or big endian (Motorola) word. Decoding is then a load,
+ * a shift, a mask and an optional sign extension.
+ *
+ * Signals that are not byte aligned and have more than 57 bits span a
+ * ninth byte, which is handled separately.
+ */
+struct VECTOR_DBC_EXPORT SignalLayout {
+    /** First byte of the signal within the message data */
+    uint16_t byteOffset {};
+
+    /** Number of bytes the signal spans (0 for invalid bit sizes, up to 9) */
+    uint8_t byteCount {};
+
+    /**
+     * Position of the LSB within the window.
+     * For big endian signals spanning nine bytes, the position of the LSB within the ninth byte.
+     */
+    uint8_t shift {};
+
+    /** Window is loaded as big endian word (Motorola) */
+    bool byteSwap {};
+
+    /** Value Type is signed */
+    bool valueSigned {};
+
+    /** Mask of the raw value bits */
+    uint64_t mask {};
+
+    /** Bits above the MSB that are set for negative values (0 if unsigned) */
+    uint64_t signExtension {};
+
+    SignalLayout() = default;
+
+    /**
+     * @brief Compile the extraction plan
+     * @param[in] startBit Start Bit
+     * @param[in] bitSize Bit Size (1..64, otherwise the layout is empty)
+     * @param[in] byteOrder Byte Order
+     * @param[in] valueType Value Type
+     */
+    SignalLayout(uint32_t startBit, uint32_t bitSize, ByteOrder byteOrder, ValueType valueType);
+
+    /**
+     * @brief Locate the signal within a single 64-bit window load
+     * @param[in] size Size of data in bytes
+     * @param[out] origin First byte of the window
+     * @param[out] windowShift Position of the LSB within the window
+     * @return false if the signal doesn't fit into an 8 byte window within size
+     *
+     * The window starts at byteOffset, or earlier if it would exceed the
+     * end of the data.
+     */
+    bool window(std::size_t size, std::size_t & origin, unsigned int & windowShift) const {
+        if ((byteCount == 0) || (byteCount > 8) || (size < 8) || (byteOffset + byteCount > size))
+            return false;
+        origin = (byteOffset + 8u <= size) ? byteOffset : size - 8;
+        unsigned int adjust = 8 * (byteOffset - origin);
+        windowShift = byteSwap ? shift - adjust : shift + adjust;
+        return true;
+    }
+
+    /**
+     * @brief Decodes/Extracts a signal from a window located by window()
+     * @param[in] data Data
+     * @param[in] origin First byte of the window
+     * @param[in] windowShift Position of the LSB within the window
+     * @return Raw signal value
+     */
+    uint64_t decodeWindow(const uint8_t * data, std::size_t origin, unsigned int windowShift) const {
+        uint64_t retVal = byteSwap ? loadBigEndian(data + origin) : loadLittleEndian(data + origin);
+        retVal = (retVal >> windowShift) & mask;
+
+        /* if signed and MSB is set, then fill all bits above MSB with 1 */
+        if (retVal & (signExtension >> 1))
+            retVal |= signExtension;
+
+        return retVal;
+    }
+
+    /**
+     * @brief Decodes/Extracts a signal bytewise from its byte span
+     * @param[in] data Data
+     * @return Raw signal value
+     *
+     * Reads exactly the bytes byteOffset to byteOffset + byteCount - 1
+     * without bounds checks. The caller guarantees that they are available,
+     * e.g. for frames of message size of a verified message layout.
+     */
+    uint64_t decodeSpan(const uint8_t * data) const {
+        const uint8_t * src = data + byteOffset;
+        const unsigned int count = (byteCount > 8) ? 8 : byteCount;
+        uint64_t retVal = 0;
+        if (byteSwap) {
+            for (unsigned int i = 0; i < count; ++i)
+                retVal |= uint64_t(src[i]) << (56 - 8 * i);
+            if (byteCount > 8)
+                retVal = (retVal << (8 - shift)) | (src[8] >> shift);
+            else
+                retVal >>= shift;
+        } else {
+            for (unsigned int i = 0; i < count; ++i)
+                retVal |= uint64_t(src[i]) << (8 * i);
+            retVal >>= shift;
+            if (byteCount > 8)
+                retVal |= uint64_t(src[8]) << (64 - shift);
+        }
+        retVal &= mask;
+
+        /* if signed and MSB is set, then fill all bits above MSB with 1 */
+        if (retVal & (signExtension >> 1))
+            retVal |= signExtension;
+
+        return retVal;
+    }
+
+    /**
+     * @brief Decodes/Extracts a signal from the message data
+     * @param[in] data Data
+     * @param[in] size Size of data in bytes
+     * @return Raw signal value
+     *
+     * Bytes beyond size are read as zero.
+     */
+    uint64_t decode(const uint8_t * data, std::size_t size) const;
+
+    /**
+     * @brief Encodes a signal into the message data
+     * @param[inout] data Data
+     * @param[in] size Size of data in bytes
+     * @param[in] rawValue Raw signal value
+     *
+     * Bytes beyond size are not written.
+     */
+    void encode(uint8_t * data, std::size_t size, uint64_t rawValue) const;
+
+    /* compilers merge these into a single (byte swapping) load/store */
+
+    /** Load 8 bytes as little endian word */
+    static uint64_t loadLittleEndian(const uint8_t * p) {
+        return
+            (uint64_t(p[0]) <<  0) | (uint64_t(p[1]) <<  8) | (uint64_t(p[2]) << 16) | (uint64_t(p[3]) << 24) |
+            (uint64_t(p[4]) << 32) | (uint64_t(p[5]) << 40) | (uint64_t(p[6]) << 48) | (uint64_t(p[7]) << 56);
+    }
+
+    /** Load 8 bytes as big endian word */
+    static uint64_t loadBigEndian(const uint8_t * p) {
+        return
+            (uint64_t(p[0]) << 56) | (uint64_t(p[1]) << 48) | (uint64_t(p[2]) << 40) | (uint64_t(p[3]) << 32) |
+            (uint64_t(p[4]) << 24) | (uint64_t(p[5]) << 16) | (uint64_t(p[6]) <<  8) | (uint64_t(p[7]) <<  0);
+    }
+
+    /** Store 8 bytes as little endian word */
+    static void storeLittleEndian(uint8_t * p, uint64_t v) {
+        p[0] = uint8_t(v >>  0); p[1] = uint8_t(v >>  8); p[2] = uint8_t(v >> 16); p[3] = uint8_t(v >> 24);
+        p[4] = uint8_t(v >> 32); p[5] = uint8_t(v >> 40); p[6] = uint8_t(v >> 48); p[7] = uint8_t(v >> 56);
+    }
+
+    /** Store 8 bytes as big endian word */
+    static void storeBigEndian(uint8_t * p, uint64_t v) {
+        p[0] = uint8_t(v >> 56); p[1] = uint8_t(v >> 48); p[2] = uint8_t(v >> 40); p[3] = uint8_t(v >> 32);
+        p[4] = uint8_t(v >> 24); p[5] = uint8_t(v >> 16); p[6] = uint8_t(v >>  8); p[7] = uint8_t(v >>  0);
+    }
+};
+
+}
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * String View
+ *
+ * Non-owning reference to a character sequence (std::string_view is C++17).
+ * A default constructed view has data == nullptr, which lookups use to
+ * indicate that nothing was found.
+ */
+struct VECTOR_DBC_EXPORT StringView {
+    /** Characters */
+    const char * data { nullptr };
+
+    /** Number of characters */
+    std::size_t size { 0 };
+
+    StringView() = default;
+
+    /**
+     * @brief Refer to a character sequence
+     * @param[in] data Characters
+     * @param[in] size Number of characters
+     */
+    StringView(const char * data, std::size_t size) :
+        data(data),
+        size(size) {
+    }
+
+    /** @brief Refer to a null terminated string */
+    StringView(const char * data) :
+        data(data),
+        size(std::strlen(data)) {
+    }
+
+    /** @brief Refer to a string */
+    StringView(const std::string & string) :
+        data(string.data()),
+        size(string.size()) {
+    }
+
+    /** @return true if there are no characters */
+    bool empty() const {
+        return size == 0;
+    }
+
+    /** @return Copy as string */
+    std::string toString() const {
+        return std::string(data, size);
+    }
+
+    /**
+     * @brief Compare lexicographically
+     * @param[in] other Other view
+     * @return <0, 0 or >0 as std::string::compare
+     */
+    int compare(StringView other) const {
+        int result = (size && other.size) ? std::memcmp(data, other.data, std::min(size, other.size)) : 0;
+        if (result != 0)
+            return result;
+        return (size < other.size) ? -1 : (size > other.size) ? 1 : 0;
+    }
+
+    /**
+     * @brief FNV-1a hash of the characters
+     * @return Hash
+     */
+    uint64_t hash() const {
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        for (std::size_t i = 0; i < size; ++i) {
+            hash ^= static_cast<uint8_t>(data[i]);
+            hash *= 0x100000001b3ULL;
+        }
+        return hash;
+    }
+};
+
+inline bool operator==(StringView lhs, StringView rhs) {
+    return (lhs.size == rhs.size) && (lhs.compare(rhs) == 0);
+}
+
+inline bool operator!=(StringView lhs, StringView rhs) {
+    return !(lhs == rhs);
+}
+
+inline bool operator<(StringView lhs, StringView rhs) {
+    return lhs.compare(rhs) < 0;
+}
+
+inline std::ostream & operator<<(std::ostream & os, StringView stringView) {
+    return os.write(stringView.data, stringView.size);
+}
+
+}
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/SymbolTable.h>
+
+namespace Vector {
+namespace DBC {
+
+const uint32_t SymbolTable::notFound;
+const uint32_t SymbolTable::none;
+
+uint32_t SymbolTable::insert(StringView string) {
+    uint32_t id = find(string);
+    if (id != notFound)
+        return id;
+
+    /* append */
+    id = size();
+    characters.insert(characters.end(), string.data, string.data + string.size);
+    characters.push_back('\0');
+    offsets.push_back(static_cast<uint32_t>(characters.size()));
+
+    /* grow the index at half load */
+    if (2 * size() > index.size()) {
+        std::size_t capacity = 64;
+        while (capacity < 4 * size())
+            capacity *= 2;
+        index.assign(capacity, 0);
+        for (uint32_t symbol = 0; symbol < id; ++symbol) {
+            std::size_t slot = this->string(symbol).hash() & (capacity - 1);
+            while (index[slot] != 0)
+                slot = (slot + 1) & (capacity - 1);
+            index[slot] = symbol + 1;
+        }
+    }
+
+    /* insert into the index */
+    const std::size_t mask = index.size() - 1;
+    std::size_t slot = string.hash() & mask;
+    while (index[slot] != 0)
+        slot = (slot + 1) & mask;
+    index[slot] = id + 1;
+
+    return id;
+}
+
+uint32_t SymbolTable::find(StringView string) const {
+    if (index.empty())
+        return notFound;
+    const std::size_t mask = index.size() - 1;
+    for (std::size_t slot = string.hash() & mask; index[slot] != 0; slot = (slot + 1) & mask) {
+        const uint32_t id = index[slot] - 1;
+        if (this->string(id) == string)
+            return id;
+    }
+    return notFound;
+}
+
+}
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <Vector/DBC/StringView.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Symbol Table
+ *
+ * Interns strings, so that each distinct string is stored once and
+ * referred to by a 32-bit symbol id. Comparing symbols is then an integer
+ * comparison. Ids are assigned in order of first insertion.
+ *
+ * @note Returned views stay valid until the next insert.
+ */
+struct VECTOR_DBC_EXPORT SymbolTable {
+    /** Id of unknown strings */
+    static const uint32_t notFound = 0xffffffff;
+
+    /** Id of absent strings (e.g. no transmitter), never assigned to a symbol */
+    static const uint32_t none = 0xfffffffe;
+
+    /** Characters of all symbols (null terminated) */
+    std::vector<char> characters {};
+
+    /** First character per symbol (one more entry than symbols) */
+    std::vector<uint32_t> offsets { 0 };
+
+    /** Hash index (open addressing, symbol id + 1 or 0 if unused) */
+    std::vector<uint32_t> index {};
+
+    /** @return Number of symbols */
+    uint32_t size() const {
+        return static_cast<uint32_t>(offsets.size() - 1);
+    }
+
+    /**
+     * @brief Intern a string
+     * @param[in] string String
+     * @return Symbol id
+     */
+    uint32_t insert(StringView string);
+
+    /**
+     * @brief Find a string
+     * @param[in] string String
+     * @return Symbol id or notFound
+     */
+    uint32_t find(StringView string) const;
+
+    /**
+     * @brief Get the string of a symbol
+     * @param[in] id Symbol id
+     * @return String
+     */
+    StringView string(uint32_t id) const {
+        return StringView(characters.data() + offsets[id], offsets[id + 1] - offsets[id] - 1);
+    }
+};
+
+}
+}
@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/ValueDescriptionStore.h>
+
+#include <algorithm>
+
+namespace Vector {
+namespace DBC {
+
+const uint32_t ValueDescriptionStore::noTable;
+
+/** hash over the content of value descriptions */
+static uint64_t contentHash(const ValueDescriptions & valueDescriptions) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const auto & valueDescription : valueDescriptions) {
+        hash = (hash ^ valueDescription.first) * 0x100000001b3ULL;
+        hash = (hash ^ StringView(valueDescription.second).hash()) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/** reverse index slot of a description within a table */
+static uint64_t reverseHash(uint32_t table, StringView description) {
+    return description.hash() ^ (table * 0x9e3779b97f4a7c15ULL);
+}
+
+/** insert an entry into the reverse index, unless its table has the description already */
+static void insertReverse(ValueDescriptionStore & store, uint32_t table, uint32_t entry) {
+    const StringView description = store.text(entry);
+    const std::size_t mask = store.reverseIndex.size() - 1;
+    for (std::size_t slot = reverseHash(table, description) & mask; ; slot = (slot + 1) & mask) {
+        uint32_t & reverse = store.reverseIndex[slot];
+        if (reverse == 0) {
+            reverse = entry + 1;
+            return;
+        }
+        const uint32_t other = reverse - 1;
+        if ((other >= store.tables[table].entryBegin) && (other < store.tables[table].entryEnd) && (store.text(other) == description))
+            return;
+    }
+}
+
+ValueDescriptionStore::ValueDescriptionStore(const Network & network) {
+    for (const auto & valueTable : network.valueTables)
+        valueTables[valueTable.first] = insert(valueTable.second.valueDescriptions);
+    for (const auto & message : network.messages) {
+        std::vector<uint32_t> & messageSignalTables = signalTables[message.first];
+        for (const auto & signal : message.second.signals)
+            messageSignalTables.push_back(insert(signal.second.valueDescriptions));
+    }
+    for (const auto & environmentVariable : network.environmentVariables)
+        environmentVariableTables[environmentVariable.first] = insert(environmentVariable.second.valueDescriptions);
+}
+
+uint32_t ValueDescriptionStore::insert(const ValueDescriptions & valueDescriptions) {
+    if (valueDescriptions.empty())
+        return noTable;
+
+    /* share identical tables */
+    const uint64_t hash = contentHash(valueDescriptions);
+    auto candidates = tableHashes.equal_range(hash);
+    for (auto it = candidates.first; it != candidates.second; ++it) {
+        const Table & table = tables[it->second];
+        if (table.entryEnd - table.entryBegin != valueDescriptions.size())
+            continue;
+        uint32_t entry = table.entryBegin;
+        bool identical = true;
+        for (const auto & valueDescription : valueDescriptions) {
+            if ((values[entry] != valueDescription.first) || (text(entry) != StringView(valueDescription.second))) {
+                identical = false;
+                break;
+            }
+            ++entry;
+        }
+        if (identical)
+            return it->second;
+    }
+
+    /* entries, sorted by value as the map is */
+    const uint32_t tableId = static_cast<uint32_t>(tables.size());
+    Table table;
+    table.entryBegin = static_cast<uint32_t>(values.size());
+    for (const auto & valueDescription : valueDescriptions) {
+        Text text;
+        text.offset = static_cast<uint32_t>(characters.size());
+        text.size = static_cast<uint32_t>(valueDescription.second.size());
+        characters.insert(characters.end(), valueDescription.second.begin(), valueDescription.second.end());
+        characters.push_back('\0');
+        values.push_back(valueDescription.first);
+        texts.push_back(text);
+    }
+    table.entryEnd = static_cast<uint32_t>(values.size());
+    table.base = valueDescriptions.begin()->first;
+
+    /* dense slots for small contiguous ranges, at least half occupied */
+    const uint64_t range = uint64_t(valueDescriptions.rbegin()->first) - table.base + 1;
+    if ((range <= 2 * valueDescriptions.size()) && (range <= 4096)) {
+        table.slotBegin = static_cast<uint32_t>(slots.size());
+        table.slotCount = static_cast<uint32_t>(range);
+        slots.resize(slots.size() + range, 0);
+        for (uint32_t entry = table.entryBegin; entry < table.entryEnd; ++entry)
+            slots[table.slotBegin + values[entry] - table.base] = entry + 1;
+    }
+    tables.push_back(table);
+    tableHashes.emplace(hash, tableId);
+
+    /* reverse index, kept at most half full */
+    if (2 * values.size() > reverseIndex.size()) {
+        std::size_t capacity = 64;
+        while (capacity < 4 * values.size())
+            capacity *= 2;
+        reverseIndex.assign(capacity, 0);
+        for (uint32_t t = 0; t < tables.size(); ++t) {
+            for (uint32_t entry = tables[t].entryBegin; entry < tables[t].entryEnd; ++entry)
+                insertReverse(*this, t, entry);
+        }
+    } else {
+        for (uint32_t entry = table.entryBegin; entry < table.entryEnd; ++entry)
+            insertReverse(*this, tableId, entry);
+    }
+
+    return tableId;
+}
+
+StringView ValueDescriptionStore::findDescription(uint32_t table, uint32_t value) const {
+    if (table >= tables.size())
+        return StringView();
+    const Table & t = tables[table];
+
+    /* dense table */
+    if (t.slotCount) {
+        const uint32_t slot = value - t.base;
+        if ((value < t.base) || (slot >= t.slotCount) || (slots[t.slotBegin + slot] == 0))
+            return StringView();
+        return text(slots[t.slotBegin + slot] - 1);
+    }
+
+    /* sorted table */
+    auto first = values.begin() + t.entryBegin;
+    auto last = values.begin() + t.entryEnd;
+    auto it = std::lower_bound(first, last, value);
+    if ((it == last) || (*it != value))
+        return StringView();
+    return text(static_cast<uint32_t>(it - values.begin()));
+}
+
+const uint32_t * ValueDescriptionStore::findValue(uint32_t table, StringView description) const {
+    if ((table >= tables.size()) || reverseIndex.empty())
+        return nullptr;
+    const Table & t = tables[table];
+    const std::size_t mask = reverseIndex.size() - 1;
+    for (std::size_t slot = reverseHash(table, description) & mask; reverseIndex[slot] != 0; slot = (slot + 1) & mask) {
+        const uint32_t entry = reverseIndex[slot] - 1;
+        if ((entry >= t.entryBegin) && (entry < t.entryEnd) && (text(entry) == description))
+            return &values[entry];
+    }
+    return nullptr;
+}
+
+uint32_t ValueDescriptionStore::signalTable(uint32_t messageId, uint32_t signalIndex) const {
+    auto it = signalTables.find(messageId);
+    if ((it == signalTables.end()) || (signalIndex >= it->second.size()))
+        return noTable;
+    return it->second[signalIndex];
+}
+
+}
+}
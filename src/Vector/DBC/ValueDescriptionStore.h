@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Vector/DBC/Network.h>
+#include <Vector/DBC/StringView.h>
+#include <Vector/DBC/ValueDescriptions.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Value Description Store
+ *
+ * Flat storage of value descriptions, shared by all signals and
+ * environment variables with identical value descriptions.
+ *
+ * Each table has its entries sorted by value. Tables covering a small
+ * contiguous value range additionally have a dense slot array, which
+ * maps the value directly to the entry. All other tables are looked up
+ * by binary search. A hash index over all entries maps description texts
+ * back to values.
+ *
+ * @note Returned views stay valid until the next insert.
+ */
+struct VECTOR_DBC_EXPORT ValueDescriptionStore {
+    /** Table id of empty value descriptions */
+    static const uint32_t noTable = 0xffffffff;
+
+    /** Description text in characters */
+    struct Text {
+        /** Offset in characters */
+        uint32_t offset {};
+
+        /** Number of characters */
+        uint32_t size {};
+    };
+
+    /** Table */
+    struct Table {
+        /** First entry in values/texts */
+        uint32_t entryBegin {};
+
+        /** Entry after the last one in values/texts */
+        uint32_t entryEnd {};
+
+        /** Lowest value */
+        uint32_t base {};
+
+        /** First slot in slots */
+        uint32_t slotBegin {};
+
+        /** Number of slots (0 for tables looked up by binary search) */
+        uint32_t slotCount {};
+    };
+
+    /** Characters of all description texts */
+    std::vector<char> characters {};
+
+    /** Values of all entries */
+    std::vector<uint32_t> values {};
+
+    /** Description texts of all entries */
+    std::vector<Text> texts {};
+
+    /** Entry index + 1 per value - base of the dense tables (0 if there is no description) */
+    std::vector<uint32_t> slots {};
+
+    /** Tables */
+    std::vector<Table> tables {};
+
+    /** Reverse index (open addressing, entry index + 1 or 0 if unused) */
+    std::vector<uint32_t> reverseIndex {};
+
+    /** Tables per hash over their content, to share identical tables */
+    std::unordered_multimap<uint64_t, uint32_t> tableHashes {};
+
+    /** Table per value table name (VAL_TABLE) */
+    std::map<std::string, uint32_t> valueTables {};
+
+    /** Table per signal index per message id (VAL) */
+    std::map<uint32_t, std::vector<uint32_t>> signalTables {};
+
+    /** Table per environment variable name (VAL) */
+    std::map<std::string, uint32_t> environmentVariableTables {};
+
+    ValueDescriptionStore() = default;
+
+    /**
+     * @brief Store the value descriptions of a network
+     * @param[in] network Network
+     *
+     * Stores the value tables, and the value descriptions of all signals
+     * and environment variables.
+     */
+    explicit ValueDescriptionStore(const Network & network);
+
+    /**
+     * @brief Store value descriptions
+     * @param[in] valueDescriptions Value Descriptions
+     * @return Table id (or noTable for empty value descriptions)
+     *
+     * Returns the existing table id, if identical value descriptions are already stored.
+     */
+    uint32_t insert(const ValueDescriptions & valueDescriptions);
+
+    /**
+     * @brief Get the description of a value
+     * @param[in] table Table id
+     * @param[in] value Value
+     * @return Description (data is nullptr if not found)
+     */
+    StringView findDescription(uint32_t table, uint32_t value) const;
+
+    /**
+     * @brief Get the value of a description
+     * @param[in] table Table id
+     * @param[in] description Description
+     * @return Value or nullptr if not found
+     *
+     * If several values have the same description, the lowest value is returned.
+     */
+    const uint32_t * findValue(uint32_t table, StringView description) const;
+
+    /**
+     * @brief Get the table of a signal
+     * @param[in] messageId Message Identifier
+     * @param[in] signalIndex Signal index (position in Message::signals)
+     * @return Table id (or noTable if the signal has no value descriptions)
+     */
+    uint32_t signalTable(uint32_t messageId, uint32_t signalIndex) const;
+
+    /**
+     * @brief Get the description text of an entry
+     * @param[in] entry Entry index
+     * @return Description
+     */
+    StringView text(uint32_t entry) const {
+        return StringView(characters.data() + texts[entry].offset, texts[entry].size);
+    }
+};
+
+}
+}
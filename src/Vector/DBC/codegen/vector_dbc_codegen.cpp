@@ -0,0 +1,268 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+/**
+ * @file
+ *
+ * Generates a C++ header from a DBC file.
+ *
+ * The header contains one packed struct per message with the raw signal
+ * values as members. pack()/unpack() use SignalCodec, so all layout
+ * arithmetic is resolved at compile time and there are no map lookups,
+ * string keys or interpretation of Signal fields at runtime.
+ *
+ * Names that collide after conversion into C++ identifiers, e.g. a signal
+ * named X_Metadata next to the metadata struct of signal X, get the first
+ * free suffix _2, _3, ... and are reported on stderr.
+ *
+ * Syntax: vector_dbc_codegen <input.dbc> <output.h> [namespace]
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <locale>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+
+#include <Vector/DBC.h>
+
+/** C++ keywords that can't be used as member names */
+static const std::set<std::string> keywords {
+    "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool", "break",
+    "case", "catch", "char", "char16_t", "char32_t", "class", "compl", "const", "constexpr",
+    "const_cast", "continue", "decltype", "default", "delete", "do", "double", "dynamic_cast",
+    "else", "enum", "explicit", "export", "extern", "false", "float", "for", "friend", "goto",
+    "if", "inline", "int", "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq",
+    "nullptr", "operator", "or", "or_eq", "private", "protected", "public", "register",
+    "reinterpret_cast", "return", "short", "signed", "sizeof", "static", "static_assert",
+    "static_cast", "struct", "switch", "template", "this", "thread_local", "throw", "true",
+    "try", "typedef", "typeid", "typename", "union", "unsigned", "using", "virtual", "void",
+    "volatile", "wchar_t", "while", "xor", "xor_eq", "pack", "unpack", "id", "size"
+};
+
+/**
+ * @brief Convert a DBC identifier into a C++ identifier
+ * @param[in] name DBC identifier
+ * @return C++ identifier
+ */
+static std::string identifier(const std::string & name) {
+    if (keywords.count(name))
+        return name + '_';
+    return name;
+}
+
+/**
+ * @brief Make an identifier unique within a scope
+ * @param[in] name C++ identifier
+ * @param[inout] used Identifiers already used in the scope
+ * @return name, or name with the first free suffix _2, _3, ...
+ */
+static std::string unique(const std::string & name, std::set<std::string> & used) {
+    std::string result = name;
+    for (unsigned int suffix = 2; used.count(result); ++suffix)
+        result = name + '_' + std::to_string(suffix);
+    used.insert(result);
+    if (result != name)
+        std::cerr << "Name collision: " << name << " generated as " << result << std::endl;
+    return result;
+}
+
+/**
+ * @brief Get the raw value member type
+ * @param[in] signal Signal
+ * @return integer type that holds the raw value
+ */
+static std::string rawType(const Vector::DBC::Signal & signal) {
+    std::string type = (signal.valueType == Vector::DBC::ValueType::Signed) ? "int" : "uint";
+    if (signal.bitSize <= 8)
+        type += "8_t";
+    else if (signal.bitSize <= 16)
+        type += "16_t";
+    else if (signal.bitSize <= 32)
+        type += "32_t";
+    else
+        type += "64_t";
+    return type;
+}
+
+/**
+ * @brief Format a double as C++ literal
+ * @param[in] value Value
+ * @return Literal
+ */
+static std::string literal(double value) {
+    std::ostringstream oss;
+    oss.imbue(std::locale("C"));
+    oss.precision(17);
+    oss << value;
+    std::string str = oss.str();
+    if (str.find_first_of(".eEn") == std::string::npos)
+        str += ".0";
+    return str;
+}
+
+/**
+ * @brief Generate the struct of a message
+ * @param[in] os Output stream
+ * @param[in] message Message
+ * @param[in] structName Unique struct name of the message
+ */
+static void generateMessage(std::ostream & os, const Vector::DBC::Message & message, const std::string & structName) {
+    /* unique member names first, then metadata struct names, neither may equal the struct name */
+    std::set<std::string> used { structName };
+    std::map<std::string, std::string> memberNames;
+    std::map<std::string, std::string> metadataNames;
+    for (const auto & signal : message.signals)
+        memberNames[signal.first] = unique(identifier(signal.second.name), used);
+    for (const auto & signal : message.signals)
+        metadataNames[signal.first] = unique(memberNames[signal.first] + "_Metadata", used);
+
+    /* find multiplexor switch */
+    const Vector::DBC::Signal * multiplexorSwitch = nullptr;
+    for (const auto & signal : message.signals) {
+        if (signal.second.multiplexor == Vector::DBC::Signal::Multiplexor::MultiplexorSwitch)
+            multiplexorSwitch = &signal.second;
+    }
+
+    os << "/** " << message.name << " (BO_ " << message.id << ") */" << std::endl;
+    os << "struct " << structName << " {" << std::endl;
+    os << "    /** Identifier (with bit 31 set this is extended CAN frame) */" << std::endl;
+    os << "    static constexpr uint32_t id() { return 0x" << std::hex << message.id << std::dec << "UL; }" << std::endl;
+    os << std::endl;
+    os << "    /** Size */" << std::endl;
+    os << "    static constexpr uint32_t size() { return " << message.size << "; }" << std::endl;
+
+    /* signal metadata and raw value members */
+    for (const auto & signal : message.signals) {
+        const Vector::DBC::Signal & s = signal.second;
+        const std::string & name = memberNames[signal.first];
+        const std::string & metadataName = metadataNames[signal.first];
+        os << std::endl;
+        if ((s.bitSize == 0) || (s.bitSize > 64)) {
+            os << "    /* " << s.name << " skipped, invalid bit size " << s.bitSize << " */" << std::endl;
+            continue;
+        }
+        os << "    /** " << s.name << " metadata */" << std::endl;
+        os << "    struct " << metadataName << " {" << std::endl;
+        os << "        using Codec = Vector::DBC::SignalCodec<" << s.startBit << ", " << s.bitSize << ", "
+           << ((s.byteOrder == Vector::DBC::ByteOrder::BigEndian) ? "Vector::DBC::ByteOrder::BigEndian" : "Vector::DBC::ByteOrder::LittleEndian") << ", "
+           << ((s.valueType == Vector::DBC::ValueType::Signed) ? "Vector::DBC::ValueType::Signed" : "Vector::DBC::ValueType::Unsigned") << ">;" << std::endl;
+        os << "        static constexpr double factor() { return " << literal(s.factor) << "; }" << std::endl;
+        os << "        static constexpr double offset() { return " << literal(s.offset) << "; }" << std::endl;
+        os << "        static constexpr double minimum() { return " << literal(s.minimum) << "; }" << std::endl;
+        os << "        static constexpr double maximum() { return " << literal(s.maximum) << "; }" << std::endl;
+        os << "    };" << std::endl;
+        os << std::endl;
+        os << "    /** " << s.name << " (raw value) */" << std::endl;
+        os << "    " << rawType(s) << " " << name << ";" << std::endl;
+    }
+
+    /* unpack/pack */
+    for (int pack = 0; pack < 2; ++pack) {
+        os << std::endl;
+        if (pack) {
+            os << "    /** Encode all raw values into data (size bytes) */" << std::endl;
+            os << "    void pack(uint8_t * data) const {" << std::endl;
+        } else {
+            os << "    /** Decode all raw values from data (size bytes) */" << std::endl;
+            os << "    void unpack(const uint8_t * data) {" << std::endl;
+        }
+        if (multiplexorSwitch && !pack)
+            os << "        " << memberNames[multiplexorSwitch->name] << " = static_cast<" << rawType(*multiplexorSwitch) << ">("
+               << metadataNames[multiplexorSwitch->name] << "::Codec::decode(data));" << std::endl;
+        for (const auto & signal : message.signals) {
+            const Vector::DBC::Signal & s = signal.second;
+            if ((s.bitSize == 0) || (s.bitSize > 64) || ((&s == multiplexorSwitch) && !pack))
+                continue;
+            const std::string & name = memberNames[signal.first];
+            const std::string & metadataName = metadataNames[signal.first];
+            std::string indent = "        ";
+            if (multiplexorSwitch && (s.multiplexor == Vector::DBC::Signal::Multiplexor::MultiplexedSignal)) {
+                os << indent << "if (" << memberNames[multiplexorSwitch->name] << " == " << s.multiplexerSwitchValue << ")" << std::endl;
+                indent += "    ";
+            }
+            if (pack)
+                os << indent << metadataName << "::Codec::encode(data, static_cast<uint64_t>(" << name << "));" << std::endl;
+            else
+                os << indent << name << " = static_cast<" << rawType(s) << ">(" << metadataName << "::Codec::decode(data));" << std::endl;
+        }
+        os << "    }" << std::endl;
+    }
+
+    os << "};" << std::endl;
+    os << std::endl;
+}
+
+int main(int argc, char ** argv) {
+    /* safety check */
+    if ((argc != 3) && (argc != 4)) {
+        std::cout << "Syntax: vector_dbc_codegen <input.dbc> <output.h> [namespace]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::string ns = (argc == 4) ? argv[3] : "dbc";
+
+    /* load database file */
+    Vector::DBC::Network network;
+    std::ifstream ifs(argv[1]);
+    if (!ifs.is_open()) {
+        std::cerr << "Unable to open " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+    }
+    ifs >> network;
+    if (!network.successfullyParsed) {
+        std::cerr << "Unable to parse " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    /* generate header */
+    std::ofstream ofs(argv[2]);
+    if (!ofs.is_open()) {
+        std::cerr << "Unable to open " << argv[2] << std::endl;
+        return EXIT_FAILURE;
+    }
+    ofs << "/* Generated by vector_dbc_codegen from " << argv[1] << ". Do not edit. */" << std::endl;
+    ofs << std::endl;
+    ofs << "#pragma once" << std::endl;
+    ofs << std::endl;
+    ofs << "#include <cstdint>" << std::endl;
+    ofs << std::endl;
+    ofs << "#include <Vector/DBC/SignalCodec.h>" << std::endl;
+    ofs << std::endl;
+    ofs << "namespace " << ns << " {" << std::endl;
+    ofs << std::endl;
+    ofs << "#pragma pack(push, 1)" << std::endl;
+    ofs << std::endl;
+    std::set<std::string> structNames;
+    for (const auto & message : network.messages) {
+        /* pseudo message for signals that are not assigned to a message */
+        if (message.second.name == "VECTOR__INDEPENDENT_SIG_MSG")
+            continue;
+        generateMessage(ofs, message.second, unique(identifier(message.second.name), structNames));
+    }
+    ofs << "#pragma pack(pop)" << std::endl;
+    ofs << std::endl;
+    ofs << "}" << std::endl;
+
+    return EXIT_SUCCESS;
+}
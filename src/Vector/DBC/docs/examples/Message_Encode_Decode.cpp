@@ -112,7 +112,7 @@ int main() {
     /* now let's assume we have received a CAN message with the following identifier and content... */
     unsigned int canIdentifier = 0x100;
     std::vector<std::uint8_t> canData;
-    canData.reserve(4);
+    canData.resize(4);
     network.messages[canIdentifier].signals["multiplexor"].encode(canData, 0);
     network.messages[canIdentifier].signals["signal_1"].encode(canData, 0x12);
     decodeMessage(canIdentifier, canData);
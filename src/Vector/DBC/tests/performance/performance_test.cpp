@@ -19,10 +19,20 @@
  * met: http://www.gnu.org/copyleft/gpl.html.
  */
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <vector>
+
+#if !defined(WIN32)
+#include <sys/resource.h>
+#endif
 
 #include "Vector/DBC.h"
 
@@ -92,7 +102,7 @@ void performance_test_2() {
         /* and look it up */
         auto t1 = std::chrono::high_resolution_clock::now();
         for (const auto & signal : message.signals)
-            std::string & signalName = signal.second.name;
+            const std::string & signalName = signal.second.name;
         auto t2 = std::chrono::high_resolution_clock::now();
 
         /* print result */
@@ -136,10 +146,1138 @@ void performance_test_3(Vector::DBC::ByteOrder byteOrder, Vector::DBC::ValueType
     }
 }
 
+/**
+ * This measures the throughput to decode N frames of one message.
+ *
+ * The generated columns are:
+ * - Number of signals in message (1..8)
+ * - Decoded frames per second (frame by frame using Signal::decode)
+ * - Decoded frames per second (columns using BatchDecoder)
+ */
+void performance_test_4() {
+    const std::size_t frameCount = 100000;
+
+    /* setup 8 byte random data */
+    std::vector<uint8_t> frames;
+    for (std::size_t b = 0; b < 8 * frameCount; ++b)
+        frames.push_back(rand() % 0x100);
+
+    for (auto signalCount = 1; signalCount <= 8; ++signalCount) {
+        /* setup the message with mixed byte orders and value types */
+        Vector::DBC::Message message;
+        message.size = 8;
+        for (auto nr = 0; nr < signalCount; ++nr) {
+            std::string signalName = "signal_" + std::to_string(nr);
+            Vector::DBC::Signal & signal = message.signals[signalName];
+            signal.name = signalName;
+            signal.byteOrder = (nr % 2) ? Vector::DBC::ByteOrder::BigEndian : Vector::DBC::ByteOrder::LittleEndian;
+            signal.startBit = (nr % 2) ? 8 * nr + 7 : 8 * nr;
+            signal.bitSize = 8;
+            signal.valueType = (nr % 4 < 2) ? Vector::DBC::ValueType::Unsigned : Vector::DBC::ValueType::Signed;
+        }
+        std::vector<std::vector<uint64_t>> columns(signalCount, std::vector<uint64_t>(frameCount));
+        std::vector<uint64_t *> columnPointers;
+        for (auto & column : columns)
+            columnPointers.push_back(column.data());
+
+        /* frame by frame */
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (std::size_t i = 0; i < frameCount; ++i) {
+            std::size_t s = 0;
+            for (const auto & signal : message.signals)
+                columns[s++][i] = signal.second.decode(&frames[8 * i], 8);
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        /* batch */
+        Vector::DBC::BatchDecoder batchDecoder(message);
+        auto t3 = std::chrono::high_resolution_clock::now();
+        batchDecoder.decode(frames.data(), frameCount, 8, 8, columnPointers.data());
+        auto t4 = std::chrono::high_resolution_clock::now();
+
+        /* print result */
+        std::chrono::duration<double> frameByFrame = t2 - t1;
+        std::chrono::duration<double> batch = t4 - t3;
+        std::cout << signalCount
+                  << "\t" << frameCount / frameByFrame.count()
+                  << "\t" << frameCount / batch.count() << std::endl;
+    }
+}
+
+/**
+ * This measures the time to decode physical values.
+ *
+ * The columns are:
+ * - Value type (1=unsigned, 2=signed, 3=float, 4=double)
+ * - Two-step decode and rawToPhysicalValue (nanoseconds per frame)
+ * - Fused decodePhysical (nanoseconds per frame)
+ * - Batch decodePhysical (nanoseconds per frame)
+ */
+void performance_test_5() {
+    const std::size_t frameCount = 100000;
+
+    /* setup 8 byte random data */
+    std::vector<uint8_t> frames;
+    for (std::size_t b = 0; b < 8 * frameCount; ++b)
+        frames.push_back(rand() % 0x100);
+    std::vector<double> column(frameCount);
+
+    for (auto valueType = 1; valueType <= 4; ++valueType) {
+        /* setup the signal */
+        Vector::DBC::Signal signal;
+        signal.startBit = 0;
+        signal.byteOrder = Vector::DBC::ByteOrder::LittleEndian;
+        signal.factor = 0.1;
+        signal.offset = -40.0;
+        switch (valueType) {
+        case 1:
+            signal.bitSize = 16;
+            signal.valueType = Vector::DBC::ValueType::Unsigned;
+            break;
+        case 2:
+            signal.bitSize = 16;
+            signal.valueType = Vector::DBC::ValueType::Signed;
+            break;
+        case 3:
+            signal.bitSize = 32;
+            signal.extendedValueType = Vector::DBC::Signal::ExtendedValueType::Float;
+            break;
+        case 4:
+            signal.bitSize = 64;
+            signal.extendedValueType = Vector::DBC::Signal::ExtendedValueType::Double;
+            break;
+        }
+
+        /* two-step: raw decode, interpretation of the raw value, conversion */
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (std::size_t i = 0; i < frameCount; ++i) {
+            uint64_t rawValue = signal.decode(&frames[8 * i], 8);
+            double value;
+            switch (signal.extendedValueType) {
+            case Vector::DBC::Signal::ExtendedValueType::Float: {
+                float floatValue;
+                uint32_t floatBits = static_cast<uint32_t>(rawValue);
+                std::memcpy(&floatValue, &floatBits, sizeof(floatValue));
+                value = floatValue;
+            }
+            break;
+            case Vector::DBC::Signal::ExtendedValueType::Double:
+                std::memcpy(&value, &rawValue, sizeof(value));
+                break;
+            default:
+                value = (signal.valueType == Vector::DBC::ValueType::Signed) ?
+                        static_cast<double>(static_cast<int64_t>(rawValue)) :
+                        static_cast<double>(rawValue);
+                break;
+            }
+            column[i] = signal.rawToPhysicalValue(value);
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        /* fused */
+        for (std::size_t i = 0; i < frameCount; ++i)
+            column[i] = signal.decodePhysical(&frames[8 * i], 8);
+        auto t3 = std::chrono::high_resolution_clock::now();
+
+        /* batch */
+        Vector::DBC::decodeBatch(signal.layout(), signal.conversion(), frames.data(), frameCount, 8, 8, column.data());
+        auto t4 = std::chrono::high_resolution_clock::now();
+
+        /* print result */
+        std::chrono::duration<double, std::nano> twoStep = t2 - t1;
+        std::chrono::duration<double, std::nano> fused = t3 - t2;
+        std::chrono::duration<double, std::nano> batch = t4 - t3;
+        std::cout << valueType
+                  << "\t" << twoStep.count() / frameCount
+                  << "\t" << fused.count() / frameCount
+                  << "\t" << batch.count() / frameCount << std::endl;
+    }
+}
+
+/**
+ * This measures decode/encode throughput for CAN and CAN FD payloads.
+ *
+ * The columns are:
+ * - Payload size (8, 16, 32, 64 bytes)
+ * - Signal::decode of all signals (nanoseconds per frame)
+ * - MessageDecoder::decode (nanoseconds per frame)
+ * - BatchDecoder::decode (nanoseconds per frame)
+ * - MessageEncoder::frame with all signals changed (nanoseconds per frame)
+ */
+void performance_test_6() {
+    const std::size_t frameCount = 100000;
+
+    for (std::size_t size : { 8, 16, 32, 64 }) {
+        /* setup random data */
+        std::vector<uint8_t> frames;
+        for (std::size_t b = 0; b < size * frameCount; ++b)
+            frames.push_back(rand() % 0x100);
+
+        /* setup 12 bit signals with mixed byte orders, crossing 8 byte lanes */
+        Vector::DBC::Network network;
+        Vector::DBC::Message & message = network.messages[0x100];
+        message.size = size;
+        for (std::size_t nr = 0; nr < 8 * size / 12; ++nr) {
+            std::string signalName = "signal_" + std::to_string(100 + nr);
+            Vector::DBC::Signal & signal = message.signals[signalName];
+            signal.name = signalName;
+            signal.byteOrder = (nr % 2) ? Vector::DBC::ByteOrder::BigEndian : Vector::DBC::ByteOrder::LittleEndian;
+            signal.startBit = (nr % 2) ? (12 * nr / 8) * 8 + 7 - (12 * nr % 8) : 12 * nr;
+            signal.bitSize = 12;
+            signal.valueType = Vector::DBC::ValueType::Unsigned;
+        }
+        const std::size_t signalCount = message.signals.size();
+        std::vector<uint64_t> rawValues(signalCount);
+        std::vector<std::vector<uint64_t>> columns(signalCount, std::vector<uint64_t>(frameCount));
+        std::vector<uint64_t *> columnPointers;
+        for (auto & column : columns)
+            columnPointers.push_back(column.data());
+        uint64_t checksum = 0;
+
+        /* Signal::decode */
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (std::size_t i = 0; i < frameCount; ++i) {
+            for (const auto & signal : message.signals)
+                checksum += signal.second.decode(&frames[size * i], size);
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        /* MessageDecoder */
+        Vector::DBC::MessageDecoder messageDecoder(message);
+        auto t3 = std::chrono::high_resolution_clock::now();
+        for (std::size_t i = 0; i < frameCount; ++i) {
+            messageDecoder.decode(&frames[size * i], size, rawValues.data());
+            checksum += rawValues[0];
+        }
+        auto t4 = std::chrono::high_resolution_clock::now();
+
+        /* BatchDecoder */
+        Vector::DBC::BatchDecoder batchDecoder(message);
+        auto t5 = std::chrono::high_resolution_clock::now();
+        batchDecoder.decode(frames.data(), frameCount, size, size, columnPointers.data());
+        auto t6 = std::chrono::high_resolution_clock::now();
+
+        /* MessageEncoder */
+        Vector::DBC::MessageEncoder messageEncoder(network, message);
+        auto t7 = std::chrono::high_resolution_clock::now();
+        for (std::size_t i = 0; i < frameCount; ++i) {
+            for (uint32_t s = 0; s < signalCount; ++s)
+                messageEncoder.setRawValue(s, i + s);
+            checksum += messageEncoder.frame()[0];
+        }
+        auto t8 = std::chrono::high_resolution_clock::now();
+        assert(checksum != 0);
+
+        /* print result */
+        std::chrono::duration<double, std::nano> signalDecode = t2 - t1;
+        std::chrono::duration<double, std::nano> messageDecode = t4 - t3;
+        std::chrono::duration<double, std::nano> batchDecode = t6 - t5;
+        std::chrono::duration<double, std::nano> messageEncode = t8 - t7;
+        std::cout << size
+                  << "\t" << signalDecode.count() / frameCount
+                  << "\t" << messageDecode.count() / frameCount
+                  << "\t" << batchDecode.count() / frameCount
+                  << "\t" << messageEncode.count() / frameCount << std::endl;
+    }
+}
+
+/**
+ * This measures the layout validation time.
+ *
+ * The columns are:
+ * - Number of messages in database (64 byte messages with 32 signals each)
+ * - Validation time per message (nanoseconds)
+ */
+void performance_test_7() {
+    for (auto messageCount = 1000; messageCount <= 10000; messageCount += 1000) {
+        /* setup network */
+        Vector::DBC::Network network;
+        for (auto id = 0; id < messageCount; ++id) {
+            Vector::DBC::Message & message = network.messages[id];
+            message.id = id;
+            message.size = 64;
+            for (auto nr = 0; nr < 32; ++nr) {
+                std::string signalName = "signal_" + std::to_string(100 + nr);
+                Vector::DBC::Signal & signal = message.signals[signalName];
+                signal.name = signalName;
+                signal.byteOrder = (nr % 2) ? Vector::DBC::ByteOrder::BigEndian : Vector::DBC::ByteOrder::LittleEndian;
+                signal.startBit = (nr % 2) ? 16 * nr + 7 : 16 * nr;
+                signal.bitSize = 16;
+            }
+        }
+
+        /* validate */
+        auto t1 = std::chrono::high_resolution_clock::now();
+        Vector::DBC::validateLayouts(network);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        assert(network.layoutIssues.empty());
+
+        /* print result */
+        std::chrono::duration<double, std::nano> validation = t2 - t1;
+        std::cout << messageCount << "\t" << validation.count() / messageCount << std::endl;
+    }
+}
+
+/**
+ * This measures the decode time of a multiplexed message.
+ *
+ * Each multiplexor value activates 7 signals, so only a few signals
+ * are active per frame, independent of the number of signals in the message.
+ *
+ * The columns are:
+ * - Number of signals in message
+ * - Decode time scanning all signals (nanoseconds per frame)
+ * - Decode time with MessageDecoder (nanoseconds per frame)
+ */
+void performance_test_8() {
+    const std::size_t frameCount = 100000;
+
+    for (uint32_t signalCount = 29; signalCount <= 253; signalCount += 28) {
+        /* setup multiplexed message */
+        Vector::DBC::Message message;
+        message.id = 0x700;
+        message.size = 8;
+        Vector::DBC::Signal & multiplexor = message.signals["multiplexor"];
+        multiplexor.name = "multiplexor";
+        multiplexor.multiplexor = Vector::DBC::Signal::Multiplexor::MultiplexorSwitch;
+        multiplexor.byteOrder = Vector::DBC::ByteOrder::LittleEndian;
+        multiplexor.startBit = 0;
+        multiplexor.bitSize = 8;
+        for (uint32_t nr = 0; nr < signalCount - 1; ++nr) {
+            std::string signalName = "signal_" + std::to_string(100 + nr);
+            Vector::DBC::Signal & signal = message.signals[signalName];
+            signal.name = signalName;
+            signal.multiplexor = Vector::DBC::Signal::Multiplexor::MultiplexedSignal;
+            signal.multiplexerSwitchValue = nr / 7;
+            signal.byteOrder = Vector::DBC::ByteOrder::LittleEndian;
+            signal.startBit = 8 + 8 * (nr % 7);
+            signal.bitSize = 8;
+        }
+        const uint32_t switchValues = (signalCount - 1) / 7;
+
+        /* setup random data with valid multiplexor values */
+        std::vector<uint8_t> frames;
+        for (std::size_t i = 0; i < frameCount; ++i) {
+            frames.push_back(rand() % switchValues);
+            for (auto b = 1; b < 8; ++b)
+                frames.push_back(rand() % 0x100);
+        }
+        std::vector<uint64_t> rawValues(message.signals.size());
+        std::vector<uint32_t> active(message.signals.size());
+        uint64_t checksum1 = 0;
+        uint64_t checksum2 = 0;
+
+        /* scan all signals */
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (std::size_t i = 0; i < frameCount; ++i) {
+            uint64_t switchValue = multiplexor.decode(&frames[8 * i], 8);
+            for (const auto & signal : message.signals) {
+                if ((signal.second.multiplexor != Vector::DBC::Signal::Multiplexor::MultiplexedSignal) ||
+                        (signal.second.multiplexerSwitchValue == switchValue))
+                    checksum1 += signal.second.decode(&frames[8 * i], 8);
+            }
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        /* MessageDecoder */
+        Vector::DBC::MessageDecoder messageDecoder(message);
+        auto t3 = std::chrono::high_resolution_clock::now();
+        for (std::size_t i = 0; i < frameCount; ++i) {
+            std::size_t activeCount = messageDecoder.decode(&frames[8 * i], 8, rawValues.data(), active.data());
+            for (std::size_t a = 0; a < activeCount; ++a)
+                checksum2 += rawValues[active[a]];
+        }
+        auto t4 = std::chrono::high_resolution_clock::now();
+        assert(checksum1 == checksum2);
+
+        /* print result */
+        std::chrono::duration<double, std::nano> scan = t2 - t1;
+        std::chrono::duration<double, std::nano> indexed = t4 - t3;
+        std::cout << signalCount << "\t" << scan.count() / frameCount << "\t" << indexed.count() / frameCount << std::endl;
+    }
+}
+
+/**
+ * This measures the lookup time of value descriptions.
+ *
+ * The columns are:
+ * - Number of value descriptions (every second value)
+ * - Description lookup in ValueDescriptions (nanoseconds)
+ * - Description lookup in ValueDescriptionStore (nanoseconds)
+ * - Value lookup by description in ValueDescriptions (nanoseconds)
+ * - Value lookup by description in ValueDescriptionStore (nanoseconds)
+ */
+void performance_test_9() {
+    const std::size_t lookupCount = 100000;
+
+    for (uint32_t descriptionCount = 2; descriptionCount <= 256; descriptionCount *= 2) {
+        /* setup value descriptions */
+        Vector::DBC::ValueDescriptions valueDescriptions;
+        for (uint32_t value = 0; value < 2 * descriptionCount; value += 2)
+            valueDescriptions[value] = "description_" + std::to_string(value);
+        Vector::DBC::ValueDescriptionStore store;
+        const uint32_t table = store.insert(valueDescriptions);
+        std::vector<uint32_t> values;
+        std::vector<std::string> descriptions;
+        for (std::size_t i = 0; i < lookupCount; ++i) {
+            values.push_back(rand() % (2 * descriptionCount));
+            descriptions.push_back("description_" + std::to_string(values.back() & ~1));
+        }
+        std::size_t checksum1 = 0;
+        std::size_t checksum2 = 0;
+
+        /* description lookup */
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (uint32_t value : values) {
+            auto it = valueDescriptions.find(value);
+            if (it != valueDescriptions.end())
+                checksum1 += it->second.size();
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        for (uint32_t value : values)
+            checksum2 += store.findDescription(table, value).size;
+        auto t3 = std::chrono::high_resolution_clock::now();
+        assert(checksum1 == checksum2);
+
+        /* value lookup */
+        auto t4 = std::chrono::high_resolution_clock::now();
+        for (const std::string & description : descriptions) {
+            for (const auto & valueDescription : valueDescriptions) {
+                if (valueDescription.second == description) {
+                    checksum1 += valueDescription.first;
+                    break;
+                }
+            }
+        }
+        auto t5 = std::chrono::high_resolution_clock::now();
+        for (const std::string & description : descriptions)
+            checksum2 += *store.findValue(table, description);
+        auto t6 = std::chrono::high_resolution_clock::now();
+        assert(checksum1 == checksum2);
+
+        /* print result */
+        std::chrono::duration<double, std::nano> mapDescription = t2 - t1;
+        std::chrono::duration<double, std::nano> storeDescription = t3 - t2;
+        std::chrono::duration<double, std::nano> mapValue = t5 - t4;
+        std::chrono::duration<double, std::nano> storeValue = t6 - t5;
+        std::cout << descriptionCount
+                  << "\t" << mapDescription.count() / lookupCount
+                  << "\t" << storeDescription.count() / lookupCount
+                  << "\t" << mapValue.count() / lookupCount
+                  << "\t" << storeValue.count() / lookupCount << std::endl;
+    }
+}
+
+/**
+ * This measures the lookup time of messages by identifier.
+ *
+ * Up to 1024 messages have standard identifiers, the others
+ * extended identifiers.
+ *
+ * The columns are:
+ * - Number of messages in database
+ * - Lookup time of known identifiers with Network::findMessage (nanoseconds)
+ * - Lookup time of known identifiers with MessageDispatcher::findDecoder (nanoseconds)
+ * - Lookup time of unknown identifiers with Network::findMessage (nanoseconds)
+ * - Lookup time of unknown identifiers with MessageDispatcher::findDecoder (nanoseconds)
+ */
+void performance_test_10() {
+    const std::size_t lookupCount = 1000000;
+
+    for (auto messageCount = 1000; messageCount <= 10000; messageCount += 1000) {
+        /* setup network */
+        Vector::DBC::Network network;
+        std::vector<uint32_t> ids;
+        while (network.messages.size() < messageCount) {
+            bool extended = (network.messages.size() % 2) || (network.messages.size() >= 2048);
+            uint32_t id = extended ? (0x80000000 | (rand() & 0x1FFFFFFF)) : (rand() % 2048);
+            if (network.messages.count(id))
+                continue;
+            Vector::DBC::Message & message = network.messages[id];
+            message.id = id;
+            message.size = 8;
+            ids.push_back(id);
+        }
+        Vector::DBC::MessageDispatcher dispatcher(network);
+
+        /* known and unknown identifiers in random order */
+        std::vector<uint32_t> knownIds;
+        std::vector<uint32_t> unknownIds;
+        for (std::size_t i = 0; i < lookupCount; ++i) {
+            knownIds.push_back(ids[rand() % ids.size()]);
+            uint32_t id;
+            do {
+                id = (i % 2) ? (0x80000000 | (rand() & 0x1FFFFFFF)) : (rand() % 2048);
+            } while (network.messages.count(id));
+            unknownIds.push_back(id);
+        }
+        std::size_t found1 = 0;
+        std::size_t found2 = 0;
+
+        /* lookups */
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (uint32_t id : knownIds)
+            found1 += (network.findMessage(id) != nullptr);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        for (uint32_t id : knownIds)
+            found2 += (dispatcher.findDecoder(id) != nullptr);
+        auto t3 = std::chrono::high_resolution_clock::now();
+        for (uint32_t id : unknownIds)
+            found1 += (network.findMessage(id) != nullptr);
+        auto t4 = std::chrono::high_resolution_clock::now();
+        for (uint32_t id : unknownIds)
+            found2 += (dispatcher.findDecoder(id) != nullptr);
+        auto t5 = std::chrono::high_resolution_clock::now();
+        assert(found1 == lookupCount);
+        assert(found2 == lookupCount);
+
+        /* print result */
+        std::chrono::duration<double, std::nano> mapKnown = t2 - t1;
+        std::chrono::duration<double, std::nano> indexKnown = t3 - t2;
+        std::chrono::duration<double, std::nano> mapUnknown = t4 - t3;
+        std::chrono::duration<double, std::nano> indexUnknown = t5 - t4;
+        std::cout << messageCount
+                  << "\t" << mapKnown.count() / lookupCount
+                  << "\t" << indexKnown.count() / lookupCount
+                  << "\t" << mapUnknown.count() / lookupCount
+                  << "\t" << indexUnknown.count() / lookupCount << std::endl;
+    }
+}
+
+/**
+ * This measures the time to decode all signals of a CAN FD frame.
+ *
+ * The columns are:
+ * - Number of signals in message
+ * - Decode time iterating Message::signals (nanoseconds per frame)
+ * - Decode time with MessageDecoder (nanoseconds per frame)
+ * - Decode time with CompiledMessage (nanoseconds per frame)
+ */
+void performance_test_11() {
+    const std::size_t frameCount = 100000;
+    const std::size_t size = 64;
+
+    /* setup random data */
+    std::vector<uint8_t> frames;
+    for (std::size_t b = 0; b < size * frameCount; ++b)
+        frames.push_back(rand() % 0x100);
+
+    for (std::size_t signalCount = 4; signalCount <= 40; signalCount += 4) {
+        /* setup 12 bit signals with mixed byte orders */
+        Vector::DBC::Message message;
+        message.size = size;
+        for (std::size_t nr = 0; nr < signalCount; ++nr) {
+            std::string signalName = "signal_" + std::to_string(100 + nr);
+            Vector::DBC::Signal & signal = message.signals[signalName];
+            signal.name = signalName;
+            signal.byteOrder = (nr % 2) ? Vector::DBC::ByteOrder::BigEndian : Vector::DBC::ByteOrder::LittleEndian;
+            signal.startBit = (nr % 2) ? (12 * nr / 8) * 8 + 7 - (12 * nr % 8) : 12 * nr;
+            signal.bitSize = 12;
+            signal.valueType = Vector::DBC::ValueType::Unsigned;
+        }
+        std::vector<uint64_t> rawValues(signalCount);
+        uint64_t checksum1 = 0;
+        uint64_t checksum2 = 0;
+        uint64_t checksum3 = 0;
+
+        /* Message::signals */
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (std::size_t i = 0; i < frameCount; ++i) {
+            for (const auto & signal : message.signals)
+                checksum1 += signal.second.decode(&frames[size * i], size);
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        /* MessageDecoder */
+        Vector::DBC::MessageDecoder messageDecoder(message);
+        auto t3 = std::chrono::high_resolution_clock::now();
+        for (std::size_t i = 0; i < frameCount; ++i) {
+            messageDecoder.decode(&frames[size * i], size, rawValues.data());
+            for (uint64_t rawValue : rawValues)
+                checksum2 += rawValue;
+        }
+        auto t4 = std::chrono::high_resolution_clock::now();
+
+        /* CompiledMessage */
+        Vector::DBC::CompiledMessage compiledMessage(message);
+        auto t5 = std::chrono::high_resolution_clock::now();
+        for (std::size_t i = 0; i < frameCount; ++i) {
+            compiledMessage.decode(&frames[size * i], size, rawValues.data());
+            for (uint64_t rawValue : rawValues)
+                checksum3 += rawValue;
+        }
+        auto t6 = std::chrono::high_resolution_clock::now();
+        assert(checksum1 == checksum2);
+        assert(checksum1 == checksum3);
+
+        /* print result */
+        std::chrono::duration<double, std::nano> signals = t2 - t1;
+        std::chrono::duration<double, std::nano> decoder = t4 - t3;
+        std::chrono::duration<double, std::nano> compiled = t6 - t5;
+        std::cout << signalCount
+                  << "\t" << signals.count() / frameCount
+                  << "\t" << decoder.count() / frameCount
+                  << "\t" << compiled.count() / frameCount << std::endl;
+    }
+}
+
+/**
+ * @brief Generate a database
+ * @param[in] messageCount Number of messages
+ * @return Database with 16 signals per message, comments, attributes and value descriptions
+ */
+std::string syntheticDatabase(unsigned int messageCount) {
+    std::ostringstream oss;
+    oss << "VERSION \"\"\n\nNS_ :\n\nBS_:\n\nBU_: ECU_1 ECU_2\n\n";
+    for (unsigned int id = 0; id < messageCount; ++id) {
+        oss << "BO_ " << id << " Message_" << id << ": 8 ECU_1\n";
+        for (unsigned int nr = 0; nr < 16; ++nr)
+            oss << " SG_ Signal_" << id << "_" << nr << " : " << 4 * nr << "|4@1+ (0.5,0) [0|7.5] \"km/h\" ECU_2\n";
+        oss << "\n";
+    }
+    for (unsigned int id = 0; id < messageCount; ++id) {
+        oss << "CM_ BO_ " << id << " \"Comment of message " << id << "\";\n";
+        for (unsigned int nr = 0; nr < 16; ++nr)
+            oss << "CM_ SG_ " << id << " Signal_" << id << "_" << nr << " \"Comment of signal " << nr << "\";\n";
+    }
+    oss << "BA_DEF_ BO_ \"GenMsgCycleTime\" INT 0 65535;\n";
+    oss << "BA_DEF_ SG_ \"GenSigStartValue\" INT 0 15;\n";
+    oss << "BA_DEF_DEF_ \"GenMsgCycleTime\" 0;\n";
+    oss << "BA_DEF_DEF_ \"GenSigStartValue\" 0;\n";
+    for (unsigned int id = 0; id < messageCount; ++id) {
+        oss << "BA_ \"GenMsgCycleTime\" BO_ " << id << " 100;\n";
+        for (unsigned int nr = 0; nr < 16; ++nr)
+            oss << "BA_ \"GenSigStartValue\" SG_ " << id << " Signal_" << id << "_" << nr << " " << nr % 16 << ";\n";
+    }
+    for (unsigned int id = 0; id < messageCount; ++id) {
+        for (unsigned int nr = 0; nr < 16; ++nr)
+            oss << "VAL_ " << id << " Signal_" << id << "_" << nr << " 0 \"Off\" 1 \"On\" ;\n";
+    }
+    return oss.str();
+}
+
+/**
+ * This measures the time to load and unload a database.
+ *
+ * The columns are:
+ * - Number of messages in database (16 signals each)
+ * - Load time of the network (milliseconds)
+ * - Unload time of the network (milliseconds)
+ */
+void performance_test_12() {
+    for (unsigned int messageCount = 250; messageCount <= 5000; messageCount += 250) {
+        std::string database = syntheticDatabase(messageCount);
+
+        /* load and unload */
+        Vector::DBC::Network * network = new Vector::DBC::Network;
+        std::istringstream iss(database);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        iss >> *network;
+        auto t2 = std::chrono::high_resolution_clock::now();
+        delete network;
+        auto t3 = std::chrono::high_resolution_clock::now();
+
+        /* print result */
+        std::chrono::duration<double, std::milli> loadNetwork = t2 - t1;
+        std::chrono::duration<double, std::milli> unloadNetwork = t3 - t2;
+        std::cout << messageCount
+                  << "\t" << loadNetwork.count()
+                  << "\t" << unloadNetwork.count() << std::endl;
+    }
+}
+
+/**
+ * This measures the lookup time of J1939 messages.
+ *
+ * The columns are:
+ * - Number of J1939 messages in database (PDU2 format)
+ * - Lookup time of the defined identifier in Network::messages (nanoseconds)
+ * - Lookup time of the defined identifier with the dispatcher (nanoseconds)
+ * - Lookup time of runtime identifiers (random priority and source address) by PGN (nanoseconds)
+ */
+void performance_test_13() {
+    const std::size_t lookupCount = 1000000;
+
+    for (auto messageCount = 250; messageCount <= 4000; messageCount += 250) {
+        /* setup network with distinct PGNs */
+        Vector::DBC::Network network;
+        std::vector<uint32_t> ids;
+        while (network.messages.size() < static_cast<std::size_t>(messageCount)) {
+            uint32_t pgn = 0xF000 | (rand() & 0x0FFF);
+            uint32_t id = 0x80000000 | (6 << 26) | (pgn << 8) | 0xFE;
+            if (network.messages.count(id))
+                continue;
+            Vector::DBC::Message & message = network.messages[id];
+            message.id = id;
+            message.size = 8;
+            ids.push_back(id);
+        }
+        Vector::DBC::MessageDispatcher dispatcher(network);
+
+        /* defined identifiers and runtime identifiers in random order */
+        std::vector<uint32_t> definedIds;
+        std::vector<uint32_t> runtimeIds;
+        for (std::size_t i = 0; i < lookupCount; ++i) {
+            uint32_t id = ids[rand() % ids.size()];
+            definedIds.push_back(id);
+            runtimeIds.push_back((id & 0x83FFFF00) | ((rand() % 8) << 26) | (rand() % 0x100));
+        }
+        std::size_t found1 = 0;
+        std::size_t found2 = 0;
+        std::size_t found3 = 0;
+
+        /* lookups */
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (uint32_t id : definedIds)
+            found1 += (network.findMessage(id) != nullptr);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        for (uint32_t id : definedIds)
+            found2 += (dispatcher.findDecoder(id) != nullptr);
+        auto t3 = std::chrono::high_resolution_clock::now();
+        for (uint32_t id : runtimeIds)
+            found3 += (dispatcher.findJ1939Decoder(id) != nullptr);
+        auto t4 = std::chrono::high_resolution_clock::now();
+        assert(found1 == lookupCount);
+        assert(found2 == lookupCount);
+        assert(found3 == lookupCount);
+
+        /* print result */
+        std::chrono::duration<double, std::nano> map = t2 - t1;
+        std::chrono::duration<double, std::nano> index = t3 - t2;
+        std::chrono::duration<double, std::nano> j1939 = t4 - t3;
+        std::cout << messageCount
+                  << "\t" << map.count() / lookupCount
+                  << "\t" << index.count() / lookupCount
+                  << "\t" << j1939.count() / lookupCount << std::endl;
+    }
+}
+
+/**
+ * This measures the time to find the signals received by a node.
+ *
+ * The columns are:
+ * - Number of messages in database (16 signals each, 32 nodes)
+ * - Query time scanning all signals (microseconds)
+ * - Query time of RelationIndex, first query including the build (microseconds)
+ * - Query time of RelationIndex, later queries (microseconds)
+ */
+void performance_test_14() {
+    const std::size_t queryCount = 100;
+
+    for (auto messageCount = 250; messageCount <= 5000; messageCount += 250) {
+        /* setup network with random receivers */
+        Vector::DBC::Network network;
+        for (auto id = 0; id < messageCount; ++id) {
+            Vector::DBC::Message & message = network.messages[id];
+            message.id = id;
+            message.transmitter = "ECU_" + std::to_string(id % 32);
+            for (auto nr = 0; nr < 16; ++nr) {
+                Vector::DBC::Signal & signal = message.signals["signal_" + std::to_string(nr)];
+                signal.receivers.insert("ECU_" + std::to_string(rand() % 32));
+                signal.receivers.insert("ECU_" + std::to_string(rand() % 32));
+            }
+        }
+        std::vector<std::string> nodes;
+        for (std::size_t i = 0; i < queryCount; ++i)
+            nodes.push_back("ECU_" + std::to_string(rand() % 32));
+        std::size_t found1 = 0;
+        std::size_t found2 = 0;
+
+        /* scan */
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (const std::string & node : nodes) {
+            for (const auto & message : network.messages) {
+                for (const auto & signal : message.second.signals)
+                    found1 += signal.second.receivers.count(node);
+            }
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        /* index */
+        Vector::DBC::RelationIndex relationIndex(network);
+        found2 += relationIndex.signalsReceivedBy(nodes[0]).size();
+        auto t3 = std::chrono::high_resolution_clock::now();
+        for (std::size_t i = 1; i < queryCount; ++i)
+            found2 += relationIndex.signalsReceivedBy(nodes[i]).size();
+        auto t4 = std::chrono::high_resolution_clock::now();
+        assert(found1 == found2);
+
+        /* print result */
+        std::chrono::duration<double, std::micro> scan = t2 - t1;
+        std::chrono::duration<double, std::micro> build = t3 - t2;
+        std::chrono::duration<double, std::micro> query = t4 - t3;
+        std::cout << messageCount
+                  << "\t" << scan.count() / queryCount
+                  << "\t" << build.count()
+                  << "\t" << query.count() / (queryCount - 1) << std::endl;
+    }
+}
+
+/**
+ * This measures the time to read a message attribute with default fallback.
+ *
+ * The columns are:
+ * - Number of messages in database (every second one with an attribute value)
+ * - Lookup time via attributeValues and attributeDefaults (nanoseconds)
+ * - Lookup time with AttributeResolver (nanoseconds)
+ */
+void performance_test_15() {
+    const std::size_t lookupCount = 1000000;
+
+    for (auto messageCount = 250; messageCount <= 5000; messageCount += 250) {
+        /* setup network with 8 message attributes */
+        Vector::DBC::Network network;
+        for (auto nr = 0; nr < 8; ++nr) {
+            std::string attributeName = "GenMsgAttribute_" + std::to_string(nr);
+            Vector::DBC::AttributeDefinition & attributeDefinition = network.attributeDefinitions[attributeName];
+            attributeDefinition.name = attributeName;
+            attributeDefinition.objectType = Vector::DBC::AttributeObjectType::Message;
+            attributeDefinition.valueType.type = Vector::DBC::AttributeValueType::Type::Int;
+            network.attributeDefaults[attributeName].integerValue = nr;
+        }
+        for (auto id = 0; id < messageCount; ++id) {
+            Vector::DBC::Message & message = network.messages[id];
+            message.id = id;
+            for (auto nr = id % 2; nr < 8; nr += 2)
+                message.attributeValues["GenMsgAttribute_" + std::to_string(nr)].integerValue = id;
+        }
+        const std::string attributeName = "GenMsgAttribute_3";
+        std::vector<uint32_t> ids;
+        for (std::size_t i = 0; i < lookupCount; ++i)
+            ids.push_back(rand() % messageCount);
+        int64_t sum1 = 0;
+        int64_t sum2 = 0;
+
+        /* maps */
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (uint32_t id : ids) {
+            const Vector::DBC::Message & message = network.messages[id];
+            auto attributeValue = message.attributeValues.find(attributeName);
+            if (attributeValue != message.attributeValues.cend())
+                sum1 += attributeValue->second.integerValue;
+            else
+                sum1 += network.attributeDefaults.find(attributeName)->second.integerValue;
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        /* resolver */
+        Vector::DBC::AttributeResolver attributeResolver(network);
+        uint32_t attributeId = attributeResolver.attributeId(attributeName);
+        auto t3 = std::chrono::high_resolution_clock::now();
+        for (uint32_t id : ids)
+            sum2 += attributeResolver.integerValue(attributeId, attributeResolver.messageIndex(id));
+        auto t4 = std::chrono::high_resolution_clock::now();
+        assert(sum1 == sum2);
+
+        /* print result */
+        std::chrono::duration<double, std::nano> maps = t2 - t1;
+        std::chrono::duration<double, std::nano> resolver = t4 - t3;
+        std::cout << messageCount
+                  << "\t" << maps.count() / lookupCount
+                  << "\t" << resolver.count() / lookupCount << std::endl;
+    }
+}
+
+/**
+ * This measures the memory and scan time of message attributes in maps and in an AttributeTable.
+ *
+ * The columns are:
+ * - Number of messages in database (4 attribute values each)
+ * - Memory of the attribute values in maps (bytes)
+ * - Memory of the attribute values in AttributeTable (bytes)
+ * - Scan time of all messages with an enum value in maps (microseconds)
+ * - Scan time of all messages with an enum value in AttributeTable (microseconds)
+ */
+void performance_test_16() {
+    for (auto messageCount = 250; messageCount <= 5000; messageCount += 250) {
+        /* setup network with 4 message attributes */
+        Vector::DBC::Network network;
+        const char * attributeNames[] = { "GenMsgCycleTime", "GenMsgDelayTime", "GenMsgStartDelayTime", "GenMsgSendType" };
+        for (const char * attributeName : attributeNames) {
+            Vector::DBC::AttributeDefinition & attributeDefinition = network.attributeDefinitions[attributeName];
+            attributeDefinition.name = attributeName;
+            attributeDefinition.objectType = Vector::DBC::AttributeObjectType::Message;
+            attributeDefinition.valueType.type = Vector::DBC::AttributeValueType::Type::Int;
+        }
+        network.attributeDefinitions["GenMsgSendType"].valueType.type = Vector::DBC::AttributeValueType::Type::Enum;
+        network.attributeDefinitions["GenMsgSendType"].valueType.enumValues = { "Cyclic", "Spontaneous", "IfActive" };
+        for (auto id = 0; id < messageCount; ++id) {
+            Vector::DBC::Message & message = network.messages[id];
+            message.id = id;
+            for (const char * attributeName : attributeNames) {
+                Vector::DBC::Attribute & attribute = message.attributeValues[attributeName];
+                attribute.name = attributeName;
+                attribute.objectType = Vector::DBC::AttributeObjectType::Message;
+                attribute.integerValue = rand() % 3;
+            }
+        }
+        std::size_t mapMemory = network.memoryUsage().attributeValues;
+
+        /* maps */
+        std::vector<uint32_t> ids1;
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (const auto & message : network.messages) {
+            auto attributeValue = message.second.attributeValues.find("GenMsgSendType");
+            if ((attributeValue != message.second.attributeValues.cend()) && (attributeValue->second.enumValue == 0))
+                ids1.push_back(message.first);
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        /* table */
+        Vector::DBC::AttributeTable attributeTable;
+        attributeTable.extract(network);
+        std::size_t tableMemory = sizeof(attributeTable) + attributeTable.strings.characters.capacity();
+        for (const Vector::DBC::AttributeTable::Column & column : attributeTable.columns) {
+            tableMemory += sizeof(column) + column.name.capacity() +
+                column.objects.capacity() * sizeof(uint32_t) +
+                column.integerValues.capacity() * sizeof(int32_t) +
+                column.floatValues.capacity() * sizeof(double) +
+                column.stringValues.capacity() * sizeof(uint32_t);
+        }
+        uint32_t column = attributeTable.findColumn("GenMsgSendType", Vector::DBC::AttributeObjectType::Message);
+        auto t3 = std::chrono::high_resolution_clock::now();
+        std::vector<uint32_t> ids2 = attributeTable.select(column, "Cyclic");
+        auto t4 = std::chrono::high_resolution_clock::now();
+        assert(ids1 == ids2);
+
+        /* print result */
+        std::chrono::duration<double, std::micro> maps = t2 - t1;
+        std::chrono::duration<double, std::micro> table = t4 - t3;
+        std::cout << messageCount
+                  << "\t" << mapMemory
+                  << "\t" << tableMemory
+                  << "\t" << maps.count()
+                  << "\t" << table.count() << std::endl;
+    }
+}
+
+/**
+ * This measures the time to read an attribute value on a node and mapped received signal (BU_SG_REL).
+ *
+ * The columns are:
+ * - Number of messages in database (4 signals each, mapped to one of 2 nodes)
+ * - Lookup time via attributeRelationValues (nanoseconds)
+ * - Lookup time with AttributeRelationIndex (nanoseconds)
+ */
+void performance_test_17() {
+    const std::size_t lookupCount = 1000000;
+
+    for (auto messageCount = 250; messageCount <= 5000; messageCount += 250) {
+        /* setup network with one relation attribute per message and signal */
+        Vector::DBC::Network network;
+        for (auto id = 0; id < messageCount; ++id) {
+            for (auto nr = 0; nr < 4; ++nr) {
+                Vector::DBC::AttributeRelation attributeRelation;
+                attributeRelation.name = "GenSigGatewayed";
+                attributeRelation.objectType = Vector::DBC::AttributeObjectType::NodeMappedRxSignal;
+                attributeRelation.nodeName = (id % 2) ? "ECU_1" : "ECU_2";
+                attributeRelation.messageId = id;
+                attributeRelation.signalName = "Signal_" + std::to_string(nr);
+                attributeRelation.integerValue = id + nr;
+                network.attributeRelationValues[Vector::DBC::AttributeRelationKey(attributeRelation)] = attributeRelation;
+            }
+        }
+        const std::string attributeName = "GenSigGatewayed";
+        const std::string nodeNames[2] = { "ECU_2", "ECU_1" };
+        const std::string signalNames[4] = { "Signal_0", "Signal_1", "Signal_2", "Signal_3" };
+        std::vector<uint32_t> ids;
+        for (std::size_t i = 0; i < lookupCount; ++i)
+            ids.push_back(rand() % messageCount);
+        int64_t sum1 = 0;
+        int64_t sum2 = 0;
+
+        /* map */
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (uint32_t id : ids) {
+            Vector::DBC::AttributeRelationKey key;
+            key.name = attributeName;
+            key.objectType = Vector::DBC::AttributeObjectType::NodeMappedRxSignal;
+            key.nodeName = nodeNames[id % 2];
+            key.messageId = id;
+            key.signalName = signalNames[id % 4];
+            auto attributeRelation = network.attributeRelationValues.find(key);
+            if (attributeRelation != network.attributeRelationValues.cend())
+                sum1 += attributeRelation->second.integerValue;
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        /* index */
+        Vector::DBC::AttributeRelationIndex attributeRelationIndex(network);
+        auto t3 = std::chrono::high_resolution_clock::now();
+        for (uint32_t id : ids) {
+            const Vector::DBC::AttributeRelation * attributeRelation =
+                attributeRelationIndex.findNodeMappedRxSignal(attributeName, nodeNames[id % 2], id, signalNames[id % 4]);
+            if (attributeRelation)
+                sum2 += attributeRelation->integerValue;
+        }
+        auto t4 = std::chrono::high_resolution_clock::now();
+        assert(sum1 == sum2);
+
+        /* print result */
+        std::chrono::duration<double, std::nano> set = t2 - t1;
+        std::chrono::duration<double, std::nano> index = t4 - t3;
+        std::cout << messageCount
+                  << "\t" << set.count() / lookupCount
+                  << "\t" << index.count() / lookupCount << std::endl;
+    }
+}
+
+/**
+ * This measures the parse throughput of a database file,
+ * read via an istream and mapped into memory.
+ *
+ * The columns are:
+ * - Number of messages in database (16 signals each)
+ * - File size (MB)
+ * - Throughput via std::ifstream (MB/s)
+ * - Throughput via Network::load from the file name (MB/s)
+ * - Throughput via Network::load from memory (MB/s)
+ */
+void performance_test_18() {
+    const std::string fileName = "performance_test_18.dbc";
+
+    for (unsigned int messageCount = 2500; messageCount <= 25000; messageCount += 2500) {
+        std::string database = syntheticDatabase(messageCount);
+        {
+            std::ofstream ofs(fileName, std::ios::binary);
+            ofs << database;
+        }
+        double megaBytes = database.size() / 1e6;
+
+        /* istream */
+        Vector::DBC::Network network1;
+        auto t1 = std::chrono::high_resolution_clock::now();
+        {
+            std::ifstream ifs(fileName);
+            ifs >> network1;
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        /* mapped file */
+        Vector::DBC::Network network2;
+        auto t3 = std::chrono::high_resolution_clock::now();
+        network2.load(fileName);
+        auto t4 = std::chrono::high_resolution_clock::now();
+
+        /* memory */
+        Vector::DBC::Network network3;
+        auto t5 = std::chrono::high_resolution_clock::now();
+        network3.load(database.data(), database.size());
+        auto t6 = std::chrono::high_resolution_clock::now();
+        assert(network1.messages.size() == network2.messages.size());
+        assert(network1.messages.size() == network3.messages.size());
+
+        /* print result */
+        std::chrono::duration<double> istream = t2 - t1;
+        std::chrono::duration<double> mappedFile = t4 - t3;
+        std::chrono::duration<double> memory = t6 - t5;
+        std::cout << messageCount
+                  << "\t" << megaBytes
+                  << "\t" << megaBytes / istream.count()
+                  << "\t" << megaBytes / mappedFile.count()
+                  << "\t" << megaBytes / memory.count() << std::endl;
+    }
+    std::remove(fileName.c_str());
+}
+
+/**
+ * This measures the parse throughput from memory, i.e. scanner and parser without I/O.
+ *
+ * The columns are:
+ * - Number of messages in database (16 signals each)
+ * - Database size (MB)
+ * - Throughput, best of 5 runs (MB/s)
+ * - Lines per second, best of 5 runs (million lines/s)
+ */
+void performance_test_19() {
+    const unsigned int runCount = 5;
+
+    for (unsigned int messageCount = 1000; messageCount <= 10000; messageCount += 1000) {
+        std::string database = syntheticDatabase(messageCount);
+        double megaBytes = database.size() / 1e6;
+        std::size_t lineCount = std::count(database.cbegin(), database.cend(), '\n');
+
+        /* best of runs */
+        std::chrono::duration<double> best = std::chrono::duration<double>::max();
+        for (unsigned int run = 0; run < runCount; ++run) {
+            Vector::DBC::Network network;
+            auto t1 = std::chrono::high_resolution_clock::now();
+            network.load(database.data(), database.size());
+            auto t2 = std::chrono::high_resolution_clock::now();
+            if (t2 - t1 < best)
+                best = t2 - t1;
+        }
+
+        /* print result */
+        std::cout << messageCount
+                  << "\t" << megaBytes
+                  << "\t" << megaBytes / best.count()
+                  << "\t" << lineCount / 1e6 / best.count() << std::endl;
+    }
+}
+
+/**
+ * @brief Peak resident set size
+ * @return Peak resident set size in bytes (0 if unknown)
+ */
+std::size_t peakResidentSetSize() {
+#if !defined(WIN32)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(__APPLE__)
+        return usage.ru_maxrss;
+#else
+        return usage.ru_maxrss * 1024;
+#endif
+    }
+#endif
+    return 0;
+}
+
+/**
+ * This loads a database file and prints its memory usage.
+ *
+ * The rows are:
+ * - Memory usage per category (bytes)
+ * - Peak resident set size before and after loading (bytes)
+ * - Load time (milliseconds)
+ */
+void performance_test_memory(const std::string & fileName) {
+    std::size_t rssBefore = peakResidentSetSize();
+
+    /* load database file */
+    Vector::DBC::Network network;
+    std::ifstream ifs(fileName);
+    if (!ifs.is_open()) {
+        std::cerr << "Unable to open " << fileName << std::endl;
+        return;
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    ifs >> network;
+    auto t2 = std::chrono::high_resolution_clock::now();
+    if (!network.successfullyParsed)
+        std::cerr << "Unable to parse " << fileName << std::endl;
+
+    /* print result */
+    std::chrono::duration<double, std::milli> load = t2 - t1;
+    std::cout << network.memoryUsage();
+    std::cout << "peak RSS before load\t" << rssBefore << std::endl;
+    std::cout << "peak RSS\t" << peakResidentSetSize() << std::endl;
+    std::cout << "load time (ms)\t" << load.count() << std::endl;
+}
+
+/**
+ * @brief Prints the command line syntax
+ */
+void usage() {
+    std::cout << "Syntax: performance_test <test id>" << std::endl;
+    std::cout << "        performance_test memory <dbc file>" << std::endl;
+}
+
 int main(int argc, char ** argv) {
     /* safety check */
-    if (argc != 2) {
-        std::cout << "Syntax: performance_test <test id>" << std::endl;
+    if ((argc < 2) || (argc > 3)) {
+        usage();
         return -1;
     }
 
@@ -158,6 +1296,45 @@ int main(int argc, char ** argv) {
         performance_test_3(Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Signed);
     else if (id == "3bu")
         performance_test_3(Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Unsigned);
+    else if (id == "4")
+        performance_test_4();
+    else if (id == "5")
+        performance_test_5();
+    else if (id == "6")
+        performance_test_6();
+    else if (id == "7")
+        performance_test_7();
+    else if (id == "8")
+        performance_test_8();
+    else if (id == "9")
+        performance_test_9();
+    else if (id == "10")
+        performance_test_10();
+    else if (id == "11")
+        performance_test_11();
+    else if (id == "12")
+        performance_test_12();
+    else if (id == "13")
+        performance_test_13();
+    else if (id == "14")
+        performance_test_14();
+    else if (id == "15")
+        performance_test_15();
+    else if (id == "16")
+        performance_test_16();
+    else if (id == "17")
+        performance_test_17();
+    else if (id == "18")
+        performance_test_18();
+    else if (id == "19")
+        performance_test_19();
+    else if (id == "memory") {
+        if (argc != 3) {
+            usage();
+            return -1;
+        }
+        performance_test_memory(argv[2]);
+    }
 
     return 0;
 }
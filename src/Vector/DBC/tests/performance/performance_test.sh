@@ -82,6 +82,203 @@ set output "table_${ID}.pdf"
 plot 'table_${ID}.csv' using 1:2
 END
 
+ID="4"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "throughput to decode frames of one message"
+set xlabel "number of signals"
+set ylabel "frames per second"
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "frame by frame", 'table_${ID}.csv' using 1:3 title "batch"
+END
+
+ID="5"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "time to decode a physical value"
+set xlabel "value type (1=unsigned, 2=signed, 3=float, 4=double)"
+set ylabel "decode time per frame (ns)"
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "two-step", 'table_${ID}.csv' using 1:3 title "fused", 'table_${ID}.csv' using 1:4 title "batch"
+END
+
+ID="6"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "time to decode/encode a frame (CAN and CAN FD)"
+set xlabel "payload size (bytes)"
+set ylabel "time per frame (ns)"
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "Signal::decode", 'table_${ID}.csv' using 1:3 title "MessageDecoder", 'table_${ID}.csv' using 1:4 title "BatchDecoder", 'table_${ID}.csv' using 1:5 title "MessageEncoder"
+END
+
+ID="7"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "layout validation time per message"
+set xlabel "number of messages"
+set ylabel "validation time (ns)"
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2
+END
+
+ID="8"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "decode time of a multiplexed message (7 active signals per frame)"
+set xlabel "number of signals in message"
+set ylabel "decode time per frame (ns)"
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "scan all signals", 'table_${ID}.csv' using 1:3 title "MessageDecoder"
+END
+
+ID="9"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "value description lookup time"
+set xlabel "number of value descriptions"
+set ylabel "lookup time (ns)"
+set logscale x 2
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "value to description (map)", 'table_${ID}.csv' using 1:3 title "value to description (store)", 'table_${ID}.csv' using 1:4 title "description to value (map)", 'table_${ID}.csv' using 1:5 title "description to value (store)"
+END
+
+ID="10"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "message lookup time by identifier"
+set xlabel "number of messages"
+set ylabel "lookup time (ns)"
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "known (map)", 'table_${ID}.csv' using 1:3 title "known (dispatcher)", 'table_${ID}.csv' using 1:4 title "unknown (map)", 'table_${ID}.csv' using 1:5 title "unknown (dispatcher)"
+END
+
+ID="11"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "time to decode all signals of a CAN FD frame"
+set xlabel "number of signals"
+set ylabel "decode time per frame (ns)"
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "Message::signals", 'table_${ID}.csv' using 1:3 title "MessageDecoder", 'table_${ID}.csv' using 1:4 title "CompiledMessage"
+END
+
+ID="12"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "time to load and unload a database (16 signals per message)"
+set xlabel "number of messages"
+set ylabel "time (ms)"
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "load", 'table_${ID}.csv' using 1:3 title "unload"
+END
+
+ID="13"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "J1939 message lookup time"
+set xlabel "number of messages"
+set ylabel "lookup time (ns)"
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "defined identifier (map)", 'table_${ID}.csv' using 1:3 title "defined identifier (dispatcher)", 'table_${ID}.csv' using 1:4 title "runtime identifier (J1939 index)"
+END
+
+ID="14"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "time to find the signals received by a node"
+set xlabel "number of messages"
+set ylabel "query time (us)"
+set logscale y
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "scan all signals", 'table_${ID}.csv' using 1:3 title "RelationIndex (first query)", 'table_${ID}.csv' using 1:4 title "RelationIndex"
+END
+
+ID="15"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "time to read a message attribute with default fallback"
+set xlabel "number of messages"
+set ylabel "lookup time (ns)"
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "attributeValues/attributeDefaults", 'table_${ID}.csv' using 1:3 title "AttributeResolver"
+END
+
+ID="16"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "memory of message attributes (4 per message)"
+set xlabel "number of messages"
+set ylabel "memory (bytes)"
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "attributeValues maps", 'table_${ID}.csv' using 1:3 title "AttributeTable"
+set title "time to select all messages with an enum attribute value"
+set ylabel "scan time (us)"
+plot 'table_${ID}.csv' using 1:4 title "attributeValues maps", 'table_${ID}.csv' using 1:5 title "AttributeTable"
+END
+
+ID="17"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "time to read an attribute value on a node and mapped received signal"
+set xlabel "number of messages"
+set ylabel "lookup time (ns)"
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "attributeRelationValues", 'table_${ID}.csv' using 1:3 title "AttributeRelationIndex"
+END
+
+ID="18"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "parse throughput of a database file (16 signals per message)"
+set xlabel "file size (MB)"
+set ylabel "throughput (MB/s)"
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 2:3 title "std::ifstream", 'table_${ID}.csv' using 2:4 title "Network::load (file)", 'table_${ID}.csv' using 2:5 title "Network::load (memory)"
+END
+
+ID="19"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "parse throughput from memory (16 signals per message)"
+set xlabel "database size (MB)"
+set ylabel "throughput (MB/s)"
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 2:3 title "Network::load (memory)"
+END
+
 echo "Generating report"
 pdftk table_*.pdf cat output - > performance_measurement.pdf
 
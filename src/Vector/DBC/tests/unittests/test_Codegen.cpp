@@ -0,0 +1,86 @@
+#define BOOST_TEST_MODULE Codegen
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <type_traits>
+#include <vector>
+#include <boost/filesystem.hpp>
+
+#include <Vector/DBC.h>
+
+/* generated by vector_dbc_codegen */
+#include "Database.h"
+#include "NameCollisions.h"
+
+/**
+ * Checks the generated pack/unpack functions against Signal::decode/encode.
+ */
+BOOST_AUTO_TEST_CASE(Codegen) {
+    Vector::DBC::Network network;
+
+    /* load database file */
+    boost::filesystem::path infile(CMAKE_CURRENT_SOURCE_DIR "/data/Database.dbc");
+    std::ifstream ifs(infile.string());
+    ifs >> network;
+    BOOST_REQUIRE(network.successfullyParsed);
+
+    /* metadata */
+    BOOST_CHECK_EQUAL(Database::Extended_Message_1::id(), 0x80000001);
+    BOOST_CHECK_EQUAL(Database::Extended_Message_1::size(), 8);
+    BOOST_CHECK_EQUAL(Database::Standard_Message_1::Signal_8_VtSig_Metadata::factor(), 1.0);
+
+    /* unpack */
+    const Vector::DBC::Message & message = network.messages.at(1);
+    std::vector<uint8_t> data { 0x81, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+    Database::Standard_Message_1 standardMessage1;
+    standardMessage1.unpack(data.data());
+    BOOST_CHECK_EQUAL(standardMessage1.Signal_8_VtSig, int8_t(message.signals.at("Signal_8_VtSig").decode(data)));
+
+    /* pack */
+    std::vector<uint8_t> expectedData(8);
+    message.signals.at("Signal_8_VtSig").encode(expectedData, uint64_t(-5));
+    std::vector<uint8_t> packedData(8);
+    standardMessage1.Signal_8_VtSig = -5;
+    standardMessage1.pack(packedData.data());
+    BOOST_CHECK(packedData == expectedData);
+
+    /* multiplexed signals are only unpacked if the switch matches */
+    Database::Multiplexed_Message multiplexedMessage {};
+    data = { 0x01, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+    multiplexedMessage.unpack(data.data());
+    BOOST_CHECK_EQUAL(multiplexedMessage.Multiplexor, 1);
+    BOOST_CHECK_EQUAL(multiplexedMessage.Signal_8, 0x7F);
+    data = { 0x02, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+    multiplexedMessage.unpack(data.data());
+    BOOST_CHECK_EQUAL(multiplexedMessage.Multiplexor, 2);
+    BOOST_CHECK_EQUAL(multiplexedMessage.Signal_8, 0x7F);
+}
+
+/**
+ * Checks that colliding names are generated with unique suffixes.
+ */
+BOOST_AUTO_TEST_CASE(UniqueNames) {
+    /* message "class" is generated as class_, so message "class_" becomes class__2 */
+    BOOST_CHECK_EQUAL(NameCollisions::class_::id(), 1);
+    BOOST_CHECK_EQUAL(NameCollisions::class__2::id(), 2);
+
+    /* signal S_Metadata keeps its name, the metadata of signal S is moved to S_Metadata_2 */
+    BOOST_CHECK((std::is_same<decltype(NameCollisions::class_::S_Metadata), uint8_t>::value));
+    BOOST_CHECK((std::is_same<NameCollisions::class_::S_Metadata_2::Codec, Vector::DBC::SignalCodec<0, 8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned> >::value));
+    BOOST_CHECK((std::is_same<NameCollisions::class_::S_Metadata_Metadata::Codec, Vector::DBC::SignalCodec<8, 8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned> >::value));
+
+    /* signal class_ can't be named like its struct */
+    NameCollisions::class_ message {};
+    const uint8_t data[8] { 0x11, 0x22, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00 };
+    message.unpack(data);
+    BOOST_CHECK_EQUAL(message.S, 0x11);
+    BOOST_CHECK_EQUAL(message.S_Metadata, 0x22);
+    BOOST_CHECK_EQUAL(message.class__2, 0x33);
+    uint8_t packedData[8] {};
+    message.pack(packedData);
+    BOOST_CHECK_EQUAL_COLLECTIONS(data, data + 8, packedData, packedData + 8);
+}
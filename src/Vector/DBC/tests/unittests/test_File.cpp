@@ -5,7 +5,9 @@
 #include <boost/test/unit_test.hpp>
 
 #include <fstream>
+#include <sstream>
 #include <string>
+#include <vector>
 #include <boost/filesystem.hpp>
 
 #include <Vector/DBC.h>
@@ -40,3 +42,66 @@ BOOST_AUTO_TEST_CASE(File) {
     std::istream_iterator<char> b2(ifs2), e2;
     BOOST_CHECK_EQUAL_COLLECTIONS(b1, e1, b2, e2);
 }
+
+/**
+ * Check that a mapped file contains the file data.
+ */
+BOOST_AUTO_TEST_CASE(MappedFile) {
+    boost::filesystem::path infile(CMAKE_CURRENT_SOURCE_DIR "/data/Database.dbc");
+    std::ifstream ifs(infile.string(), std::ios::binary);
+    BOOST_REQUIRE(ifs.is_open());
+    std::ostringstream oss;
+    oss << ifs.rdbuf();
+
+    Vector::DBC::MappedFile mappedFile(infile.string());
+    BOOST_REQUIRE(mappedFile.isOpen());
+    BOOST_CHECK_EQUAL(std::string(mappedFile.data, mappedFile.size), oss.str());
+    mappedFile.close();
+    BOOST_CHECK(!mappedFile.isOpen());
+
+    BOOST_CHECK(!mappedFile.open(CMAKE_CURRENT_SOURCE_DIR "/data/NotExisting.dbc"));
+    BOOST_CHECK(!mappedFile.isOpen());
+}
+
+/**
+ * Check that loading from a file name or memory gives the same network as the istream.
+ */
+BOOST_AUTO_TEST_CASE(Load) {
+    boost::filesystem::path infile(CMAKE_CURRENT_SOURCE_DIR "/data/Database.dbc");
+
+    /* istream */
+    Vector::DBC::Network network1;
+    std::ifstream ifs(infile.string());
+    BOOST_REQUIRE(ifs.is_open());
+    ifs >> network1;
+    BOOST_REQUIRE(network1.successfullyParsed);
+    std::ostringstream oss1;
+    oss1 << network1;
+
+    /* file name */
+    Vector::DBC::Network network2;
+    BOOST_REQUIRE(network2.load(infile.string()));
+    std::ostringstream oss2;
+    oss2 << network2;
+    BOOST_CHECK_EQUAL(oss1.str(), oss2.str());
+
+    /* memory */
+    Vector::DBC::MappedFile mappedFile(infile.string());
+    BOOST_REQUIRE(mappedFile.isOpen());
+    Vector::DBC::Network network3;
+    BOOST_REQUIRE(network3.load(mappedFile.data, mappedFile.size));
+    std::ostringstream oss3;
+    oss3 << network3;
+    BOOST_CHECK_EQUAL(oss1.str(), oss3.str());
+
+    /* not existing file */
+    Vector::DBC::Network network4;
+    BOOST_CHECK(!network4.load(CMAKE_CURRENT_SOURCE_DIR "/data/NotExisting.dbc"));
+    BOOST_CHECK(!network4.successfullyParsed);
+
+    /* empty buffer ends the input instead of reading std::cin */
+    Vector::DBC::Network network5;
+    std::vector<char> empty;
+    BOOST_CHECK(!network5.load(empty.data(), empty.size()));
+    BOOST_CHECK(network5.messages.empty());
+}
@@ -4,14 +4,57 @@
 #endif
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <boost/filesystem.hpp>
 
 #include <Vector/DBC.h>
 
+/**
+ * @brief Add a little endian signal to a message
+ * @param[inout] message Message
+ * @param[in] name Signal Name
+ * @param[in] multiplexor Multiplexor
+ * @param[in] switchValue Multiplexer Switch Value
+ * @param[in] startBit Start Bit
+ * @param[in] bitSize Bit Size
+ * @param[in] byteOrder Byte Order
+ * @return Signal
+ */
+static Vector::DBC::Signal & addSignal(Vector::DBC::Message & message, const std::string & name, Vector::DBC::Signal::Multiplexor multiplexor, uint32_t switchValue, uint32_t startBit,
+                                       uint32_t bitSize = 8, Vector::DBC::ByteOrder byteOrder = Vector::DBC::ByteOrder::LittleEndian) {
+    Vector::DBC::Signal & signal = message.signals[name];
+    signal.name = name;
+    signal.multiplexor = multiplexor;
+    signal.multiplexerSwitchValue = switchValue;
+    signal.startBit = startBit;
+    signal.bitSize = bitSize;
+    signal.byteOrder = byteOrder;
+    signal.factor = 1.0;
+    return signal;
+}
+
+/**
+ * @brief Add an extended multiplexor (SG_MUL_VAL) to a signal
+ * @param[inout] signal Signal
+ * @param[in] switchName Multiplexor Switch Name
+ * @param[in] valueRanges Value Ranges, the first one is also the switch value
+ * @return Signal
+ */
+static Vector::DBC::Signal & addExtendedMultiplexor(Vector::DBC::Signal & signal, const std::string & switchName, std::set<Vector::DBC::ExtendedMultiplexor::ValueRange> valueRanges) {
+    Vector::DBC::ExtendedMultiplexor & extendedMultiplexor = signal.extendedMultiplexors[switchName];
+    extendedMultiplexor.switchName = switchName;
+    extendedMultiplexor.valueRanges = valueRanges;
+    signal.multiplexerSwitchValue = valueRanges.cbegin()->first;
+    return signal;
+}
+
 BOOST_AUTO_TEST_CASE(Message) {
     Vector::DBC::Network network;
 
@@ -142,3 +185,898 @@ BOOST_AUTO_TEST_CASE(MultiLineComments) {
     /* check if the comment is correctly parsed */
     BOOST_CHECK_EQUAL(signal.comment, "Comment\r\n");
 }
+
+/*
+ * Checks const lookups and decoding/encoding straight from raw buffers.
+ */
+BOOST_AUTO_TEST_CASE(FindAndDecodeRawBuffer) {
+    Vector::DBC::Network network;
+    Vector::DBC::Message & message = network.messages[0x123];
+    message.id = 0x123;
+    message.size = 8;
+    Vector::DBC::Signal & signal = message.signals["Signal_1"];
+    signal.name = "Signal_1";
+    signal.startBit = 8;
+    signal.bitSize = 16;
+    signal.byteOrder = Vector::DBC::ByteOrder::LittleEndian;
+    signal.valueType = Vector::DBC::ValueType::Unsigned;
+
+    /* lookups */
+    const Vector::DBC::Network & constNetwork = network;
+    BOOST_CHECK(constNetwork.findMessage(0x124) == nullptr);
+    const Vector::DBC::Message * constMessage = constNetwork.findMessage(0x123);
+    BOOST_REQUIRE(constMessage != nullptr);
+    BOOST_CHECK(constMessage->findSignal("Signal_2") == nullptr);
+    const Vector::DBC::Signal * constSignal = constMessage->findSignal("Signal_1");
+    BOOST_REQUIRE(constSignal != nullptr);
+
+    /* decode/encode on a raw receive buffer */
+    uint8_t buffer[8] = { 0x00, 0x34, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00 };
+    BOOST_CHECK_EQUAL(constSignal->decode(buffer, sizeof(buffer)), 0x1234);
+    constSignal->encode(buffer, sizeof(buffer), 0xABCD);
+    BOOST_CHECK_EQUAL(buffer[1], 0xCD);
+    BOOST_CHECK_EQUAL(buffer[2], 0xAB);
+}
+
+/*
+ * Checks that batch decoding into columns matches decoding frame by frame.
+ */
+BOOST_AUTO_TEST_CASE(BatchDecode) {
+    /* message with signals in various positions */
+    Vector::DBC::Message message;
+    message.size = 8;
+    struct {
+        uint32_t startBit;
+        uint32_t bitSize;
+        Vector::DBC::ByteOrder byteOrder;
+        Vector::DBC::ValueType valueType;
+        Vector::DBC::Signal::ExtendedValueType extendedValueType;
+    } layouts[] = {
+        {  0,  8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, Vector::DBC::Signal::ExtendedValueType::Integer },
+        { 12, 12, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Signed, Vector::DBC::Signal::ExtendedValueType::Integer },
+        { 39, 16, Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Unsigned, Vector::DBC::Signal::ExtendedValueType::Integer },
+        { 52, 11, Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Signed, Vector::DBC::Signal::ExtendedValueType::Integer },
+        { 60,  4, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Signed, Vector::DBC::Signal::ExtendedValueType::Integer },
+        {  3, 60, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Signed, Vector::DBC::Signal::ExtendedValueType::Integer },
+        { 32, 32, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Signed, Vector::DBC::Signal::ExtendedValueType::Float },
+        { 15, 32, Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Signed, Vector::DBC::Signal::ExtendedValueType::Float },
+        {  0, 64, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Signed, Vector::DBC::Signal::ExtendedValueType::Double },
+        {  7, 64, Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Unsigned, Vector::DBC::Signal::ExtendedValueType::Double },
+        { 70,  8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, Vector::DBC::Signal::ExtendedValueType::Integer }, // beyond size
+    };
+    for (const auto & layout : layouts) {
+        std::string name = "Signal_" + std::to_string(message.signals.size());
+        Vector::DBC::Signal & signal = message.signals[name];
+        signal.name = name;
+        signal.startBit = layout.startBit;
+        signal.bitSize = layout.bitSize;
+        signal.byteOrder = layout.byteOrder;
+        signal.valueType = layout.valueType;
+        signal.extendedValueType = layout.extendedValueType;
+        signal.factor = 0.5;
+        signal.offset = -3.0;
+    }
+    Vector::DBC::BatchDecoder batchDecoder(message);
+    BOOST_REQUIRE_EQUAL(batchDecoder.layouts.size(), message.signals.size());
+
+    /* strided frames, e.g. within a log record */
+    const std::size_t count = 103;
+    const std::size_t stride = 13;
+    std::vector<uint8_t> frames(count * stride);
+    uint32_t seed = 1;
+    for (auto & byte : frames) {
+        seed = seed * 1103515245 + 12345;
+        byte = uint8_t(seed >> 16);
+    }
+
+    for (std::size_t stride_ : { stride, std::size_t(message.size) }) {
+        std::size_t n = frames.size() / stride_ - 1;
+        std::vector<std::vector<uint64_t>> rawColumns(message.signals.size(), std::vector<uint64_t>(n));
+        std::vector<std::vector<double>> physicalColumns(message.signals.size(), std::vector<double>(n));
+        std::vector<uint64_t *> rawPointers;
+        std::vector<double *> physicalPointers;
+        for (std::size_t s = 0; s < message.signals.size(); ++s) {
+            rawPointers.push_back(rawColumns[s].data());
+            physicalPointers.push_back(physicalColumns[s].data());
+        }
+        batchDecoder.decode(frames.data(), n, stride_, message.size, rawPointers.data());
+        batchDecoder.decodePhysical(frames.data(), n, stride_, message.size, physicalPointers.data());
+
+        std::size_t s = 0;
+        for (const auto & signal : message.signals) {
+            for (std::size_t i = 0; i < n; ++i) {
+                uint64_t rawValue = signal.second.decode(frames.data() + i * stride_, message.size);
+                BOOST_REQUIRE_EQUAL(rawColumns[s][i], rawValue);
+                /* compare bitwise, as random float data contains NaNs */
+                double physicalValue = signal.second.decodePhysical(frames.data() + i * stride_, message.size);
+                BOOST_REQUIRE_EQUAL(std::memcmp(&physicalColumns[s][i], &physicalValue, sizeof(double)), 0);
+            }
+            ++s;
+        }
+    }
+}
+
+/**
+ * Check that only the signals of the current multiplexer switch value are decoded.
+ */
+BOOST_AUTO_TEST_CASE(MessageDecode) {
+    Vector::DBC::Message message;
+    message.size = 4;
+    addSignal(message, "multiplexor", Vector::DBC::Signal::Multiplexor::MultiplexorSwitch, 0, 0, 8).factor = 2.0;
+    addSignal(message, "signal_1", Vector::DBC::Signal::Multiplexor::NoMultiplexor, 0, 8, 8).factor = 2.0;
+    addSignal(message, "signal_2a", Vector::DBC::Signal::Multiplexor::MultiplexedSignal, 1, 16, 16).factor = 2.0;
+    addSignal(message, "signal_2b", Vector::DBC::Signal::Multiplexor::MultiplexedSignal, 2, 16, 16).factor = 2.0;
+
+    /* signal index is the position in message.signals */
+    const uint32_t multiplexor = 0;
+    const uint32_t signal_1 = 1;
+    const uint32_t signal_2a = 2;
+    const uint32_t signal_2b = 3;
+
+    Vector::DBC::MessageDecoder messageDecoder(message);
+    BOOST_CHECK_EQUAL(messageDecoder.signalCount, 4);
+    BOOST_CHECK_EQUAL(messageDecoder.multiplexIndex.rootCount, 2);
+    BOOST_CHECK_EQUAL(messageDecoder.multiplexIndex.rootSwitchCount, 1);
+    BOOST_CHECK_EQUAL(messageDecoder.multiplexIndex.intervals.size(), 2);
+
+    uint64_t rawValues[4] = {};
+    double physicalValues[4] = {};
+    uint32_t active[4] = {};
+    std::vector<uint8_t> data { 0x01, 0x12, 0x56, 0x34 };
+
+    /* switch value 1 */
+    BOOST_REQUIRE_EQUAL(messageDecoder.decode(data.data(), data.size(), rawValues, active), 3);
+    BOOST_CHECK_EQUAL(active[0], multiplexor);
+    BOOST_CHECK_EQUAL(active[1], signal_1);
+    BOOST_CHECK_EQUAL(active[2], signal_2a);
+    BOOST_CHECK_EQUAL(rawValues[multiplexor], 0x01);
+    BOOST_CHECK_EQUAL(rawValues[signal_1], 0x12);
+    BOOST_CHECK_EQUAL(rawValues[signal_2a], 0x3456);
+    BOOST_CHECK_EQUAL(rawValues[signal_2b], 0);
+    BOOST_REQUIRE_EQUAL(messageDecoder.decodePhysical(data.data(), data.size(), physicalValues), 3);
+    BOOST_CHECK_EQUAL(physicalValues[signal_2a], 2.0 * 0x3456);
+    BOOST_CHECK_EQUAL(physicalValues[signal_2b], 0.0);
+
+    /* switch value 2 */
+    data[0] = 0x02;
+    BOOST_REQUIRE_EQUAL(messageDecoder.decode(data.data(), data.size(), rawValues, active), 3);
+    BOOST_CHECK_EQUAL(active[2], signal_2b);
+    BOOST_CHECK_EQUAL(rawValues[signal_2b], 0x3456);
+
+    /* switch value without multiplexed signals */
+    data[0] = 0x03;
+    BOOST_CHECK_EQUAL(messageDecoder.decode(data.data(), data.size(), rawValues, active), 2);
+    BOOST_CHECK_EQUAL(messageDecoder.decodePhysical(data.data(), data.size(), physicalValues, active), 2);
+    BOOST_CHECK_EQUAL(physicalValues[multiplexor], 6.0);
+
+    /* without multiplexor switch all signals are decoded */
+    message.signals.erase("multiplexor");
+    Vector::DBC::MessageDecoder plainDecoder(message);
+    BOOST_CHECK_EQUAL(plainDecoder.multiplexIndex.rootSwitchCount, 0);
+    BOOST_CHECK_EQUAL(plainDecoder.decode(data.data(), data.size(), rawValues), 3);
+}
+
+/**
+ * Check that the encoder starts with GenSigStartValue and re-encodes changed signals.
+ */
+BOOST_AUTO_TEST_CASE(MessageEncode) {
+    Vector::DBC::Network network;
+    Vector::DBC::AttributeDefinition & attributeDefinition = network.attributeDefinitions["GenSigStartValue"];
+    attributeDefinition.name = "GenSigStartValue";
+    attributeDefinition.objectType = Vector::DBC::AttributeObjectType::Signal;
+    attributeDefinition.valueType.type = Vector::DBC::AttributeValueType::Type::Int;
+    Vector::DBC::Attribute & attributeDefault = network.attributeDefaults["GenSigStartValue"];
+    attributeDefault.name = "GenSigStartValue";
+    attributeDefault.objectType = Vector::DBC::AttributeObjectType::Signal;
+    attributeDefault.integerValue = 5;
+
+    Vector::DBC::Message & message = network.messages[0x100];
+    message.size = 24;
+    struct {
+        uint32_t startBit;
+        uint32_t bitSize;
+        Vector::DBC::ByteOrder byteOrder;
+        Vector::DBC::ValueType valueType;
+    } layouts[] = {
+        {  0,  8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned },
+        { 12, 12, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Signed },
+        { 39, 16, Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Unsigned },
+        { 52, 11, Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Signed },
+        { 64, 30, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned },
+        { 101, 64, Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Signed }, // spans nine bytes
+        { 188,  8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned }, // beyond size
+    };
+    for (const auto & layout : layouts) {
+        std::string name = "Signal_" + std::to_string(message.signals.size());
+        Vector::DBC::Signal & signal = message.signals[name];
+        signal.name = name;
+        signal.startBit = layout.startBit;
+        signal.bitSize = layout.bitSize;
+        signal.byteOrder = layout.byteOrder;
+        signal.valueType = layout.valueType;
+        signal.factor = 0.5;
+    }
+
+    /* start value of Signal_1 overrides the default */
+    Vector::DBC::Attribute & attributeValue = message.signals["Signal_1"].attributeValues["GenSigStartValue"];
+    attributeValue.name = "GenSigStartValue";
+    attributeValue.objectType = Vector::DBC::AttributeObjectType::Signal;
+    attributeValue.integerValue = -7;
+
+    /* reference encode of all signals */
+    std::vector<uint64_t> rawValues { 5, uint64_t(-7), 5, 5, 5, 5, 5 };
+    auto referenceFrame = [&]() {
+        std::vector<uint8_t> data(message.size);
+        std::size_t s = 0;
+        for (const auto & signal : message.signals)
+            signal.second.encode(data, rawValues[s++]);
+        return data;
+    };
+
+    Vector::DBC::MessageEncoder messageEncoder(network, message);
+    BOOST_REQUIRE_EQUAL(messageEncoder.entries.size(), message.signals.size());
+    std::vector<uint8_t> expectedFrame = referenceFrame();
+    BOOST_CHECK(messageEncoder.frameTemplate == expectedFrame);
+    BOOST_CHECK(messageEncoder.frame() == expectedFrame);
+
+    /* change random subsets of signals */
+    uint32_t seed = 1;
+    for (int i = 0; i < 1000; ++i) {
+        for (uint32_t s = 0; s < rawValues.size(); ++s) {
+            seed = seed * 1103515245 + 12345;
+            if (seed & 0x10000) {
+                uint64_t rawValue = (uint64_t(seed) << 32) ^ (seed * 2654435761U);
+                rawValues[s] = rawValue;
+                messageEncoder.setRawValue(s, rawValue);
+            }
+        }
+        BOOST_REQUIRE(messageEncoder.frame() == referenceFrame());
+    }
+
+    /* physical values */
+    messageEncoder.setPhysicalValue(0, 21.0);
+    BOOST_CHECK_EQUAL(messageEncoder.rawValues[0], 42);
+    BOOST_CHECK_EQUAL(messageEncoder.frame()[0], 42);
+
+    /* reset */
+    messageEncoder.reset();
+    BOOST_CHECK(messageEncoder.frame() == expectedFrame);
+
+    /* re-encoding a signal with fewer bits set clears the others */
+    messageEncoder.setRawValue(0, 0xFF);
+    BOOST_CHECK_EQUAL(messageEncoder.frame()[0], 0xFF);
+    messageEncoder.setRawValue(0, 0x01);
+    BOOST_CHECK_EQUAL(messageEncoder.frame()[0], 0x01);
+    messageEncoder.setRawValue(0, 0xFF);
+    messageEncoder.setRawValue(0, 0x10);
+    BOOST_CHECK_EQUAL(messageEncoder.frame()[0], 0x10);
+
+    /* multiplexed signals on the same bits, windowed (size 8) and bytewise (size 4) */
+    for (uint32_t size : { 8, 4 }) {
+        Vector::DBC::Message & multiplexedMessage = network.messages[0x200 + size];
+        multiplexedMessage.size = size;
+        for (uint32_t s = 0; s < 3; ++s) {
+            std::string name = "Signal_" + std::to_string(s);
+            Vector::DBC::Signal & signal = multiplexedMessage.signals[name];
+            signal.name = name;
+            signal.startBit = s ? 8 : 0;
+            signal.bitSize = s ? 16 : 8;
+            signal.byteOrder = (s == 2) ? Vector::DBC::ByteOrder::BigEndian : Vector::DBC::ByteOrder::LittleEndian;
+            signal.multiplexor = s ? Vector::DBC::Signal::Multiplexor::MultiplexedSignal : Vector::DBC::Signal::Multiplexor::MultiplexorSwitch;
+            signal.multiplexerSwitchValue = s;
+        }
+        Vector::DBC::MessageEncoder multiplexedEncoder(network, multiplexedMessage);
+
+        /* reference encodes each value in the order it's set */
+        std::vector<uint8_t> referenceData = multiplexedEncoder.frameTemplate;
+        auto set = [&](uint32_t index, uint64_t rawValue) {
+            multiplexedEncoder.setRawValue(index, rawValue);
+            multiplexedMessage.signals["Signal_" + std::to_string(index)].encode(referenceData, rawValue);
+        };
+
+        /* the signal set last wins */
+        set(0, 1);
+        set(1, 0x00F0);
+        set(2, 0x0F0F);
+        BOOST_CHECK(multiplexedEncoder.frame() == referenceData);
+        set(2, 0xFFFF);
+        set(1, 0x1234);
+        set(0, 2);
+        BOOST_CHECK(multiplexedEncoder.frame() == referenceData);
+
+        /* setting a signal again moves it to the end */
+        set(1, 0x0001);
+        set(2, 0x8000);
+        set(1, 0x0002);
+        BOOST_CHECK(multiplexedEncoder.frame() == referenceData);
+    }
+}
+
+/**
+ * Check the CAN FD DLC to length mapping and decoding of short frames.
+ */
+BOOST_AUTO_TEST_CASE(CanFd) {
+    /* DLC mapping */
+    const std::size_t lengths[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };
+    for (uint8_t dlc = 0; dlc < 16; ++dlc) {
+        BOOST_CHECK_EQUAL(Vector::DBC::dlcToLength(dlc), lengths[dlc]);
+        BOOST_CHECK_EQUAL(Vector::DBC::lengthToDlc(lengths[dlc]), dlc);
+    }
+    BOOST_CHECK_EQUAL(Vector::DBC::dlcToLength(16), 64);
+    BOOST_CHECK_EQUAL(Vector::DBC::lengthToDlc(9), 9);
+    BOOST_CHECK_EQUAL(Vector::DBC::lengthToDlc(33), 14);
+    BOOST_CHECK_EQUAL(Vector::DBC::lengthToDlc(65), 15);
+
+    /* 64 byte message with signals crossing 8 byte lanes */
+    Vector::DBC::Message message;
+    message.size = 64;
+    for (uint32_t nr = 0; nr < 16; ++nr) {
+        std::string name = "Signal_" + std::to_string(10 + nr);
+        Vector::DBC::Signal & signal = message.signals[name];
+        signal.name = name;
+        signal.byteOrder = (nr % 2) ? Vector::DBC::ByteOrder::BigEndian : Vector::DBC::ByteOrder::LittleEndian;
+        signal.startBit = 32 * nr + ((nr % 2) ? 7 : 20);
+        signal.bitSize = 24;
+        signal.valueType = Vector::DBC::ValueType::Unsigned;
+    }
+    std::vector<uint8_t> data(message.size);
+    for (std::size_t b = 0; b < data.size(); ++b)
+        data[b] = uint8_t(b * 37 + 11);
+    Vector::DBC::MessageDecoder messageDecoder(message);
+    std::vector<uint64_t> rawValues(message.signals.size());
+
+    /* frames sent with a smaller DLC read missing bytes as zero */
+    for (std::size_t length : { 64, 48, 32, 20, 8, 0 }) {
+        std::vector<uint8_t> frame(data.cbegin(), data.cbegin() + length);
+        std::vector<uint8_t> padded(frame);
+        padded.resize(message.size);
+        BOOST_REQUIRE_EQUAL(messageDecoder.decode(frame.data(), frame.size(), rawValues.data()), message.signals.size());
+        std::size_t s = 0;
+        for (const auto & signal : message.signals) {
+            BOOST_CHECK_EQUAL(rawValues[s], signal.second.decode(padded));
+            ++s;
+        }
+    }
+}
+
+/**
+ * Check the layout validation of messages.
+ */
+BOOST_AUTO_TEST_CASE(LayoutValidation) {
+    Vector::DBC::Network network;
+    Vector::DBC::Message & message = network.messages[0x100];
+    message.id = 0x100;
+    message.size = 8;
+    addSignal(message, "multiplexor", Vector::DBC::Signal::Multiplexor::MultiplexorSwitch, 0, 0, 8, Vector::DBC::ByteOrder::LittleEndian);
+    addSignal(message, "signal_1", Vector::DBC::Signal::Multiplexor::NoMultiplexor, 0, 15, 12, Vector::DBC::ByteOrder::BigEndian);
+    addSignal(message, "signal_2a", Vector::DBC::Signal::Multiplexor::MultiplexedSignal, 1, 24, 40, Vector::DBC::ByteOrder::LittleEndian);
+    addSignal(message, "signal_2b", Vector::DBC::Signal::Multiplexor::MultiplexedSignal, 2, 24, 40, Vector::DBC::ByteOrder::LittleEndian);
+
+    /* multiplexed signals of different switch values may share bits */
+    std::vector<Vector::DBC::LayoutIssue> issues;
+    BOOST_CHECK(Vector::DBC::validateLayout(message, &issues));
+    BOOST_CHECK(issues.empty());
+
+    /* big endian signal_1 occupies bits 8..15 and 20..23 */
+    addSignal(message, "signal_3", Vector::DBC::Signal::Multiplexor::MultiplexedSignal, 2, 16, 4, Vector::DBC::ByteOrder::LittleEndian);
+    BOOST_CHECK(Vector::DBC::validateLayout(message));
+    addSignal(message, "signal_3", Vector::DBC::Signal::Multiplexor::MultiplexedSignal, 2, 19, 6, Vector::DBC::ByteOrder::LittleEndian);
+    BOOST_CHECK(!Vector::DBC::validateLayout(message, &issues));
+    BOOST_REQUIRE_EQUAL(issues.size(), 2);
+    BOOST_CHECK(issues[0].type == Vector::DBC::LayoutIssue::Type::Overlap);
+    BOOST_CHECK_EQUAL(issues[0].messageId, 0x100);
+    BOOST_CHECK_EQUAL(issues[0].signalName, "signal_3");
+    BOOST_CHECK_EQUAL(issues[0].otherSignalName, "signal_1");
+    BOOST_CHECK_EQUAL(issues[1].otherSignalName, "signal_2b");
+    message.signals.erase("signal_3");
+
+    /* out of bounds */
+    addSignal(message, "signal_4", Vector::DBC::Signal::Multiplexor::NoMultiplexor, 0, 56, 2, Vector::DBC::ByteOrder::BigEndian);
+    issues.clear();
+    BOOST_CHECK(!Vector::DBC::validateLayout(message, &issues));
+    BOOST_REQUIRE_EQUAL(issues.size(), 1);
+    BOOST_CHECK(issues[0].type == Vector::DBC::LayoutIssue::Type::OutOfBounds);
+    message.signals.erase("signal_4");
+
+    /* invalid bit sizes */
+    addSignal(message, "signal_5", Vector::DBC::Signal::Multiplexor::NoMultiplexor, 0, 0, 0, Vector::DBC::ByteOrder::LittleEndian);
+    Vector::DBC::Signal & signal_6 = addSignal(message, "signal_6", Vector::DBC::Signal::Multiplexor::NoMultiplexor, 0, 0, 16, Vector::DBC::ByteOrder::LittleEndian);
+    signal_6.extendedValueType = Vector::DBC::Signal::ExtendedValueType::Float;
+    issues.clear();
+    BOOST_CHECK(!Vector::DBC::validateLayout(message, &issues));
+    BOOST_REQUIRE_EQUAL(issues.size(), 2);
+    BOOST_CHECK(issues[0].type == Vector::DBC::LayoutIssue::Type::InvalidBitSize);
+    BOOST_CHECK(issues[1].type == Vector::DBC::LayoutIssue::Type::InvalidBitSize);
+
+    /* network validation sets the verified flag used by the decoder */
+    Vector::DBC::validateLayouts(network);
+    BOOST_CHECK(!message.layoutVerified);
+    BOOST_CHECK_EQUAL(network.layoutIssues.size(), 2);
+    message.signals.erase("signal_5");
+    message.signals.erase("signal_6");
+    Vector::DBC::validateLayouts(network);
+    BOOST_CHECK(message.layoutVerified);
+    BOOST_CHECK(network.layoutIssues.empty());
+    Vector::DBC::MessageDecoder messageDecoder(message);
+    BOOST_CHECK(messageDecoder.verified);
+
+    /* verified and checked decoding give the same result */
+    std::vector<uint8_t> data { 0x02, 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE };
+    uint64_t rawValues[4] = {};
+    uint64_t checkedRawValues[4] = {};
+    BOOST_CHECK_EQUAL(messageDecoder.decode(data.data(), data.size(), rawValues), 3);
+    messageDecoder.verified = false;
+    BOOST_CHECK_EQUAL(messageDecoder.decode(data.data(), data.size(), checkedRawValues), 3);
+    for (int s = 0; s < 4; ++s)
+        BOOST_CHECK_EQUAL(rawValues[s], checkedRawValues[s]);
+
+    /* messages shorter than 8 bytes have signals that don't fit into a window */
+    message.size = 3;
+    message.signals.clear();
+    addSignal(message, "signal_1", Vector::DBC::Signal::Multiplexor::NoMultiplexor, 0, 4, 12, Vector::DBC::ByteOrder::LittleEndian);
+    addSignal(message, "signal_2", Vector::DBC::Signal::Multiplexor::NoMultiplexor, 0, 23, 8, Vector::DBC::ByteOrder::BigEndian);
+    Vector::DBC::validateLayouts(network);
+    BOOST_CHECK(message.layoutVerified);
+    Vector::DBC::MessageDecoder shortDecoder(message);
+    BOOST_CHECK(shortDecoder.verified);
+    BOOST_CHECK(!shortDecoder.entries[0].windowed);
+    BOOST_CHECK_EQUAL(shortDecoder.decode(data.data(), 3, rawValues), 2);
+    shortDecoder.verified = false;
+    BOOST_CHECK_EQUAL(shortDecoder.decode(data.data(), 3, checkedRawValues), 2);
+    BOOST_CHECK_EQUAL(rawValues[0], 0x120);
+    BOOST_CHECK_EQUAL(rawValues[1], 0x34);
+    for (int s = 0; s < 2; ++s)
+        BOOST_CHECK_EQUAL(rawValues[s], checkedRawValues[s]);
+}
+
+/**
+ * Check nested multiplexing and extended multiplexing value ranges (SG_MUL_VAL).
+ */
+BOOST_AUTO_TEST_CASE(ExtendedMultiplexing) {
+    Vector::DBC::Message message;
+    message.size = 8;
+
+    /* signal index is the position in message.signals */
+    addSignal(message, "a_multiplexor", Vector::DBC::Signal::Multiplexor::MultiplexorSwitch, 0, 0);
+    addExtendedMultiplexor(addSignal(message, "b_nested", Vector::DBC::Signal::Multiplexor::MultiplexedSignal, 0, 8), "a_multiplexor", {{1, 1}}).nestedMultiplexorSwitch = true;
+    addExtendedMultiplexor(addSignal(message, "c_signal", Vector::DBC::Signal::Multiplexor::MultiplexedSignal, 0, 16), "b_nested", {{0, 3}, {10, 20}});
+    addExtendedMultiplexor(addSignal(message, "d_signal", Vector::DBC::Signal::Multiplexor::MultiplexedSignal, 0, 24), "b_nested", {{2, 12}});
+    addExtendedMultiplexor(addSignal(message, "e_signal", Vector::DBC::Signal::Multiplexor::MultiplexedSignal, 0, 32), "a_multiplexor", {{1, 2}, {4, 5}});
+    addSignal(message, "f_signal", Vector::DBC::Signal::Multiplexor::NoMultiplexor, 0, 40);
+    addExtendedMultiplexor(addSignal(message, "g_signal", Vector::DBC::Signal::Multiplexor::MultiplexedSignal, 0, 48), "unknown", {{0, 0}});
+
+    Vector::DBC::MultiplexIndex multiplexIndex(message);
+    BOOST_CHECK_EQUAL(multiplexIndex.rootCount, 3); // a_multiplexor, f_signal, g_signal
+    BOOST_CHECK_EQUAL(multiplexIndex.rootSwitchCount, 1);
+    BOOST_CHECK_EQUAL(multiplexIndex.switches.size(), 2);
+
+    /* b_nested: [0-1] c, [2-3] c d, [4-9] d, [10-12] c d, [13-20] c */
+    BOOST_REQUIRE_EQUAL(multiplexIndex.switches[1].signal, 1);
+    BOOST_CHECK_EQUAL(multiplexIndex.switches[1].intervalEnd - multiplexIndex.switches[1].intervalBegin, 5);
+    BOOST_CHECK(multiplexIndex.interval(1, 21) == nullptr);
+    const Vector::DBC::MultiplexIndex::Interval * interval = multiplexIndex.interval(1, 11);
+    BOOST_REQUIRE(interval != nullptr);
+    BOOST_CHECK_EQUAL(interval->low, 10);
+    BOOST_CHECK_EQUAL(interval->high, 12);
+    BOOST_CHECK_EQUAL(interval->end - interval->begin, 2);
+
+    /* decode */
+    Vector::DBC::MessageDecoder messageDecoder(message);
+    uint64_t rawValues[7] = {};
+    uint32_t active[7] = {};
+    auto activeSignals = [&](uint8_t multiplexorValue, uint8_t nestedValue) {
+        std::vector<uint8_t> data { multiplexorValue, nestedValue, 0, 0, 0, 0, 0, 0 };
+        std::size_t count = messageDecoder.decode(data.data(), data.size(), rawValues, active);
+        std::vector<uint32_t> signals(active, active + count);
+        std::sort(signals.begin(), signals.end());
+        return signals;
+    };
+    BOOST_CHECK((activeSignals(0, 0) == std::vector<uint32_t> { 0, 5, 6 }));
+    BOOST_CHECK((activeSignals(1, 0) == std::vector<uint32_t> { 0, 1, 2, 4, 5, 6 }));
+    BOOST_CHECK((activeSignals(1, 2) == std::vector<uint32_t> { 0, 1, 2, 3, 4, 5, 6 }));
+    BOOST_CHECK((activeSignals(1, 5) == std::vector<uint32_t> { 0, 1, 3, 4, 5, 6 }));
+    BOOST_CHECK((activeSignals(1, 30) == std::vector<uint32_t> { 0, 1, 4, 5, 6 }));
+    BOOST_CHECK((activeSignals(2, 2) == std::vector<uint32_t> { 0, 4, 5, 6 }));
+    BOOST_CHECK((activeSignals(3, 2) == std::vector<uint32_t> { 0, 5, 6 }));
+
+    /* nested multiplexor switches are written as m<value>M */
+    std::ostringstream oss;
+    oss << message.signals["b_nested"];
+    BOOST_CHECK(oss.str().find(" SG_ b_nested m1M:") == 0);
+
+    /* cyclic nested switches are never active and don't recurse */
+    addExtendedMultiplexor(addSignal(message, "h_cycle", Vector::DBC::Signal::Multiplexor::MultiplexedSignal, 0, 56), "i_cycle", {{0, 255}}).nestedMultiplexorSwitch = true;
+    addExtendedMultiplexor(addSignal(message, "i_cycle", Vector::DBC::Signal::Multiplexor::MultiplexedSignal, 0, 60), "h_cycle", {{0, 255}}).nestedMultiplexorSwitch = true;
+    Vector::DBC::MultiplexIndex cyclicIndex(message);
+    BOOST_CHECK_EQUAL(cyclicIndex.rootCount, 3);
+    BOOST_CHECK_EQUAL(cyclicIndex.switches.size(), 2);
+    Vector::DBC::MessageDecoder cyclicDecoder(message);
+    std::vector<uint8_t> data { 1, 2, 0, 0, 0, 0, 0, 0 };
+    uint64_t cyclicRawValues[9] = {};
+    uint32_t cyclicActive[9] = {};
+    BOOST_CHECK_EQUAL(cyclicDecoder.decode(data.data(), data.size(), cyclicRawValues, cyclicActive), 7);
+}
+
+/**
+ * Check the message identifier index and dispatcher.
+ */
+BOOST_AUTO_TEST_CASE(MessageDispatch) {
+    Vector::DBC::MessageIdIndex index;
+
+    /* standard and extended identifiers */
+    index.insert(0x000, 1);
+    index.insert(0x7FF, 2);
+    index.insert(0x800, 3);
+    index.insert(0x80000000, 4);
+    index.insert(0x9FFFFFFF, 5);
+    for (uint32_t i = 0; i < 1000; ++i)
+        index.insert(0x80000000 | (i * 0x1234), 100 + i);
+    index.insert(0x9FFFFFFF, 6);
+    BOOST_CHECK_EQUAL(index.find(0x000), 1);
+    BOOST_CHECK_EQUAL(index.find(0x7FF), 2);
+    BOOST_CHECK_EQUAL(index.find(0x800), 3);
+    BOOST_CHECK_EQUAL(index.find(0x80000000), 100);
+    BOOST_CHECK_EQUAL(index.find(0x9FFFFFFF), 6);
+    for (uint32_t i = 1; i < 1000; ++i)
+        BOOST_CHECK_EQUAL(index.find(0x80000000 | (i * 0x1234)), 100 + i);
+    BOOST_CHECK_EQUAL(index.slotCount, 1002);
+    BOOST_CHECK_LE(2 * index.slotCount, index.slots.size());
+
+    /* unknown identifiers */
+    BOOST_CHECK_EQUAL(index.find(0x001), Vector::DBC::MessageIdIndex::notFound);
+    BOOST_CHECK_EQUAL(index.find(0x801), Vector::DBC::MessageIdIndex::notFound);
+    BOOST_CHECK_EQUAL(index.find(0x80000001), Vector::DBC::MessageIdIndex::notFound);
+    BOOST_CHECK_EQUAL(index.find(0x1234), Vector::DBC::MessageIdIndex::notFound);
+
+    /* dispatcher */
+    Vector::DBC::Network network;
+    Vector::DBC::Message & message1 = network.messages[0x123];
+    message1.id = 0x123;
+    message1.size = 8;
+    message1.signals["signal"].bitSize = 8;
+    message1.signals["signal"].byteOrder = Vector::DBC::ByteOrder::LittleEndian;
+    Vector::DBC::Message & message2 = network.messages[0x98FEF100];
+    message2.id = 0x98FEF100;
+    message2.size = 8;
+    message2.signals["signal_1"].bitSize = 8;
+    message2.signals["signal_2"].bitSize = 8;
+    message2.signals["signal_2"].startBit = 8;
+    Vector::DBC::MessageDispatcher dispatcher(network);
+    BOOST_REQUIRE(dispatcher.findDecoder(0x123) != nullptr);
+    BOOST_CHECK_EQUAL(dispatcher.findDecoder(0x123)->signalCount, 1);
+    BOOST_REQUIRE(dispatcher.findDecoder(0x98FEF100) != nullptr);
+    BOOST_CHECK_EQUAL(dispatcher.findDecoder(0x98FEF100)->signalCount, 2);
+    BOOST_CHECK(dispatcher.findDecoder(0x124) == nullptr);
+    BOOST_CHECK(dispatcher.findDecoder(0x18FEF100) == nullptr);
+    BOOST_CHECK(dispatcher.findDecoder(0x98FEF101) == nullptr);
+}
+
+/**
+ * Check the J1939 lookup by PGN.
+ */
+BOOST_AUTO_TEST_CASE(J1939Dispatch) {
+    /* identifier fields */
+    BOOST_CHECK_EQUAL(Vector::DBC::J1939Index::parameterGroupNumber(0x98FEF100), 0xFEF1);
+    BOOST_CHECK_EQUAL(Vector::DBC::J1939Index::parameterGroupNumber(0x8CEF2A17), 0xEF00);
+    BOOST_CHECK_EQUAL(Vector::DBC::J1939Index::parameterGroupNumber(0x0DFF1234), 0x1FF12);
+    BOOST_CHECK_EQUAL(Vector::DBC::J1939Index::priority(0x98FEF100), 6);
+    BOOST_CHECK_EQUAL(Vector::DBC::J1939Index::priority(0x8CEF2A17), 3);
+    BOOST_CHECK_EQUAL(Vector::DBC::J1939Index::sourceAddress(0x8CEF2A17), 0x17);
+    BOOST_CHECK_EQUAL(Vector::DBC::J1939Index::destinationAddress(0x8CEF2A17), 0x2A);
+    BOOST_CHECK_EQUAL(Vector::DBC::J1939Index::destinationAddress(0x98FEF100), Vector::DBC::J1939Index::globalAddress);
+
+    /* PDU2 and PDU1 messages, one PGN defined by two source addresses */
+    Vector::DBC::Network network;
+    Vector::DBC::Message & message1 = network.messages[0x98FEF100];
+    message1.id = 0x98FEF100;
+    message1.size = 8;
+    message1.signals["signal"].bitSize = 8;
+    Vector::DBC::Message & message2 = network.messages[0x8CEFFF00];
+    message2.id = 0x8CEFFF00;
+    message2.size = 8;
+    message2.signals["signal_1"].bitSize = 8;
+    message2.signals["signal_2"].bitSize = 8;
+    message2.signals["signal_2"].startBit = 8;
+    Vector::DBC::Message & message3 = network.messages[0x98FEF121];
+    message3.id = 0x98FEF121;
+    message3.size = 8;
+    message3.signals["signal_1"].bitSize = 8;
+    message3.signals["signal_2"].bitSize = 8;
+    message3.signals["signal_3"].bitSize = 8;
+    network.messages[0x123].id = 0x123;
+    Vector::DBC::MessageDispatcher dispatcher(network);
+
+    /* priority, source and destination address are masked */
+    BOOST_REQUIRE(dispatcher.findJ1939Decoder(0x8CEF2A17) != nullptr);
+    BOOST_CHECK_EQUAL(dispatcher.findJ1939Decoder(0x8CEF2A17)->signalCount, 2);
+    BOOST_CHECK_EQUAL(dispatcher.findJ1939Decoder(0x18EF0000)->signalCount, 2);
+    BOOST_CHECK_EQUAL(dispatcher.findJ1939Decoder(0x9CFEF100)->signalCount, 1);
+
+    /* source specific definition, others fall back to the first definition */
+    BOOST_CHECK_EQUAL(dispatcher.findJ1939Decoder(0x8CFEF121)->signalCount, 3);
+    BOOST_CHECK_EQUAL(dispatcher.findJ1939Decoder(0x8CFEF142)->signalCount, 1);
+
+    /* unknown PGNs and standard identifiers */
+    BOOST_CHECK(dispatcher.findJ1939Decoder(0x98FEF200) == nullptr);
+    BOOST_CHECK(dispatcher.findJ1939Decoder(0x8CEE0000) == nullptr);
+    BOOST_CHECK(dispatcher.findJ1939Decoder(0x00000123) == nullptr);
+    BOOST_CHECK(dispatcher.findDecoder(0x123) != nullptr);
+}
+
+/**
+ * Check the compiled message against Signal::decode.
+ */
+BOOST_AUTO_TEST_CASE(CompiledMessage) {
+    Vector::DBC::Message message;
+    message.id = 0x123;
+    message.size = 16;
+    for (uint32_t nr = 0; nr < 10; ++nr) {
+        /* names in reverse order of the start bits */
+        std::string signalName = "signal_" + std::to_string(9 - nr);
+        Vector::DBC::Signal & signal = message.signals[signalName];
+        signal.name = signalName;
+        signal.byteOrder = (nr % 2) ? Vector::DBC::ByteOrder::BigEndian : Vector::DBC::ByteOrder::LittleEndian;
+        signal.valueType = (nr % 3) ? Vector::DBC::ValueType::Unsigned : Vector::DBC::ValueType::Signed;
+        signal.startBit = (nr % 2) ? 12 * nr + 7 : 12 * nr;
+        signal.bitSize = 3 + nr;
+        signal.factor = 0.5;
+        signal.offset = nr;
+    }
+
+    /* unaligned 64 bit signal spanning 9 bytes */
+    Vector::DBC::Signal & wideSignal = message.signals["wide"];
+    wideSignal.name = "wide";
+    wideSignal.byteOrder = Vector::DBC::ByteOrder::LittleEndian;
+    wideSignal.startBit = 61;
+    wideSignal.bitSize = 64;
+    wideSignal.factor = 1.0;
+
+    Vector::DBC::CompiledMessage compiledMessage(message);
+    BOOST_CHECK_EQUAL(compiledMessage.id, 0x123);
+    BOOST_REQUIRE_EQUAL(compiledMessage.descriptors.size(), 11);
+    BOOST_REQUIRE_EQUAL(compiledMessage.signals.size(), 11);
+    BOOST_CHECK(!compiledMessage.windowed);
+
+    /* sorted by position in the frame, with names in the cold table */
+    for (uint32_t i = 1; i < compiledMessage.signals.size(); ++i) {
+        const Vector::DBC::SignalLayout & previous = compiledMessage.layouts[i - 1];
+        const Vector::DBC::SignalLayout & current = compiledMessage.layouts[i];
+        BOOST_CHECK((previous.byteOffset < current.byteOffset) || ((previous.byteOffset == current.byteOffset) && (previous.shift <= current.shift)));
+    }
+    BOOST_CHECK_EQUAL(compiledMessage.signals[0].name, "signal_9");
+    BOOST_CHECK_EQUAL(compiledMessage.descriptors[0].signal, 9);
+    BOOST_CHECK_EQUAL(compiledMessage.signals[5].name, "wide");
+    BOOST_CHECK_EQUAL(compiledMessage.descriptors[5].signal, 10);
+
+    /* name index */
+    for (uint32_t i = 0; i < compiledMessage.signals.size(); ++i)
+        BOOST_CHECK_EQUAL(compiledMessage.findSignal(compiledMessage.signals[i].name), i);
+    BOOST_CHECK_EQUAL(compiledMessage.findSignal("signal_10"), Vector::DBC::CompiledMessage::notFound);
+    BOOST_CHECK_EQUAL(Vector::DBC::CompiledMessage().findSignal("signal_1"), Vector::DBC::CompiledMessage::notFound);
+
+    /* full and short frames */
+    std::vector<uint8_t> data(16);
+    for (uint32_t i = 0; i < 16; ++i)
+        data[i] = static_cast<uint8_t>(0x9E * (i + 1));
+    std::vector<uint64_t> rawValues(11);
+    std::vector<double> physicalValues(11);
+    for (std::size_t size : { 16, 11 }) {
+        compiledMessage.decode(data.data(), size, rawValues.data());
+        compiledMessage.decodePhysical(data.data(), size, physicalValues.data());
+        for (uint32_t i = 0; i < compiledMessage.signals.size(); ++i) {
+            const Vector::DBC::Signal & signal = compiledMessage.signals[i];
+            BOOST_CHECK_EQUAL(rawValues[i], signal.decode(data.data(), size));
+            BOOST_CHECK_EQUAL(physicalValues[i], signal.decodePhysical(data.data(), size));
+        }
+    }
+
+    /* without the wide signal all signals are windowed */
+    message.signals.erase("wide");
+    compiledMessage = Vector::DBC::CompiledMessage(message);
+    BOOST_CHECK(compiledMessage.windowed);
+    compiledMessage.decode(data.data(), 16, rawValues.data());
+    for (uint32_t i = 0; i < compiledMessage.signals.size(); ++i)
+        BOOST_CHECK_EQUAL(rawValues[i], compiledMessage.signals[i].decode(data));
+
+    /* mixed byte orders: the big endian MSB at start bit 3 is followed by its LSB in byte 1 */
+    message.signals.clear();
+    message.size = 8;
+    Vector::DBC::Signal & motorola = message.signals["motorola"];
+    motorola.name = "motorola";
+    motorola.byteOrder = Vector::DBC::ByteOrder::BigEndian;
+    motorola.startBit = 3;
+    motorola.bitSize = 12;
+    Vector::DBC::Signal & intel = message.signals["intel"];
+    intel.name = "intel";
+    intel.byteOrder = Vector::DBC::ByteOrder::LittleEndian;
+    intel.startBit = 4;
+    intel.bitSize = 4;
+    Vector::DBC::Signal & last = message.signals["last"];
+    last.name = "last";
+    last.byteOrder = Vector::DBC::ByteOrder::BigEndian;
+    last.startBit = 23;
+    last.bitSize = 8;
+    compiledMessage = Vector::DBC::CompiledMessage(message);
+    BOOST_REQUIRE_EQUAL(compiledMessage.signals.size(), 3);
+    BOOST_CHECK_EQUAL(compiledMessage.signals[0].name, "intel");
+    BOOST_CHECK_EQUAL(compiledMessage.signals[1].name, "motorola");
+    BOOST_CHECK_EQUAL(compiledMessage.signals[2].name, "last");
+    compiledMessage.decode(data.data(), 8, rawValues.data());
+    for (uint32_t i = 0; i < compiledMessage.signals.size(); ++i)
+        BOOST_CHECK_EQUAL(rawValues[i], compiledMessage.signals[i].decode(data.data(), 8));
+}
+
+/**
+ * Check the compiled network against the message decoder/encoder.
+ */
+BOOST_AUTO_TEST_CASE(CompiledNetwork) {
+    Vector::DBC::Network network;
+    Vector::DBC::AttributeDefinition & attributeDefinition = network.attributeDefinitions["GenSigStartValue"];
+    attributeDefinition.name = "GenSigStartValue";
+    attributeDefinition.objectType = Vector::DBC::AttributeObjectType::Signal;
+    attributeDefinition.valueType.type = Vector::DBC::AttributeValueType::Type::Int;
+
+    /* multiplexed message */
+    Vector::DBC::Message & message1 = network.messages[0x200];
+    message1.id = 0x200;
+    message1.name = "Multiplexed";
+    message1.size = 8;
+    addSignal(message1, "multiplexor", Vector::DBC::Signal::Multiplexor::MultiplexorSwitch, 0, 0);
+    addSignal(message1, "signal_a", Vector::DBC::Signal::Multiplexor::MultiplexedSignal, 0, 8).unit = "km/h";
+    addSignal(message1, "signal_b", Vector::DBC::Signal::Multiplexor::MultiplexedSignal, 1, 8);
+    addSignal(message1, "signal_c", Vector::DBC::Signal::Multiplexor::MultiplexedSignal, 1, 16);
+    addSignal(message1, "signal_d", Vector::DBC::Signal::Multiplexor::NoMultiplexor, 0, 60).valueDescriptions = { { 1, "On" }, { 0xFFFFFFFF, "Invalid" } };
+    message1.signals["signal_d"].valueType = Vector::DBC::ValueType::Signed;
+    message1.signals["signal_d"].bitSize = 4;
+
+    /* extended message with start values */
+    Vector::DBC::Message & message2 = network.messages[0x80001234];
+    message2.id = 0x80001234;
+    message2.name = "Extended";
+    message2.size = 12;
+    addSignal(message2, "signal_1", Vector::DBC::Signal::Multiplexor::NoMultiplexor, 0, 4).factor = 0.5;
+    addSignal(message2, "signal_2", Vector::DBC::Signal::Multiplexor::NoMultiplexor, 0, 71).byteOrder = Vector::DBC::ByteOrder::BigEndian;
+    Vector::DBC::Attribute & attributeValue = message2.signals["signal_2"].attributeValues["GenSigStartValue"];
+    attributeValue.name = "GenSigStartValue";
+    attributeValue.integerValue = 0xA5;
+    network.nodes["ECU_1"].name = "ECU_1";
+    network.nodes["ECU_2"].name = "ECU_2";
+    message1.transmitter = "ECU_1";
+    message2.transmitters = { "ECU_1", "ECU_2" };
+    message1.signals["signal_a"].receivers = { "ECU_2" };
+    message2.signals["signal_1"].receivers = { "ECU_1", "ECU_2" };
+    Vector::DBC::validateLayouts(network);
+
+    Vector::DBC::CompiledNetwork compiledNetwork(network);
+    BOOST_REQUIRE_EQUAL(compiledNetwork.messageCount(), 2);
+    const uint32_t m1 = compiledNetwork.findMessage(0x200);
+    const uint32_t m2 = compiledNetwork.findMessage(0x80001234);
+    BOOST_REQUIRE_NE(m1, Vector::DBC::CompiledNetwork::notFound);
+    BOOST_REQUIRE_NE(m2, Vector::DBC::CompiledNetwork::notFound);
+    BOOST_CHECK_EQUAL(compiledNetwork.findMessage(0x201), Vector::DBC::CompiledNetwork::notFound);
+    BOOST_CHECK(compiledNetwork.messageName(m1) == "Multiplexed");
+    BOOST_CHECK(compiledNetwork.messageName(m2) == "Extended");
+    BOOST_CHECK_EQUAL(compiledNetwork.signalCount(m1), 5);
+    BOOST_CHECK_EQUAL(compiledNetwork.signalCount(m2), 2);
+
+    /* names */
+    BOOST_CHECK_EQUAL(compiledNetwork.findSignal(m1, "multiplexor"), 0);
+    BOOST_CHECK_EQUAL(compiledNetwork.findSignal(m1, "signal_d"), 4);
+    BOOST_CHECK_EQUAL(compiledNetwork.findSignal(m1, "signal_1"), Vector::DBC::CompiledNetwork::notFound);
+    BOOST_CHECK_EQUAL(compiledNetwork.findSignal(m2, "signal_2"), 1);
+    BOOST_CHECK(compiledNetwork.signalName(m1, 1) == "signal_a");
+    BOOST_CHECK(compiledNetwork.signalUnit(m1, 1) == "km/h");
+
+    /* node names are interned once and compared as symbols */
+    BOOST_REQUIRE_EQUAL(compiledNetwork.nodes.size(), 2);
+    const uint32_t ecu1 = compiledNetwork.nodes[0];
+    const uint32_t ecu2 = compiledNetwork.nodes[1];
+    BOOST_CHECK(compiledNetwork.symbol(ecu1) == "ECU_1");
+    BOOST_CHECK_EQUAL(compiledNetwork.symbols.find("ECU_2"), ecu2);
+    BOOST_CHECK_EQUAL(compiledNetwork.messageTransmitter[m1], ecu1);
+    BOOST_CHECK_EQUAL(compiledNetwork.receivers.size(), 3);
+    BOOST_CHECK(compiledNetwork.isTransmitter(m1, ecu1));
+    BOOST_CHECK(!compiledNetwork.isTransmitter(m1, ecu2));
+    BOOST_CHECK(compiledNetwork.isTransmitter(m2, ecu1));
+    BOOST_CHECK(compiledNetwork.isTransmitter(m2, ecu2));
+    BOOST_CHECK_EQUAL(compiledNetwork.messageTransmitter[m2], Vector::DBC::SymbolTable::none);
+    BOOST_REQUIRE_NE(compiledNetwork.symbols.find(""), Vector::DBC::SymbolTable::notFound);
+    BOOST_CHECK(!compiledNetwork.isTransmitter(m2, compiledNetwork.symbols.find("")));
+    BOOST_CHECK(!compiledNetwork.isTransmitter(m2, Vector::DBC::SymbolTable::none));
+    BOOST_CHECK(compiledNetwork.isReceiver(m1, 1, ecu2));
+    BOOST_CHECK(!compiledNetwork.isReceiver(m1, 1, ecu1));
+    BOOST_CHECK(!compiledNetwork.isReceiver(m1, 2, ecu2));
+    BOOST_CHECK(compiledNetwork.isReceiver(m2, 0, ecu1));
+    BOOST_CHECK(compiledNetwork.isReceiver(m2, 0, ecu2));
+    BOOST_CHECK(!compiledNetwork.isReceiver(m2, 1, ecu1));
+
+    /* decode as MessageDecoder does */
+    std::vector<uint8_t> data(12);
+    uint64_t rawValues1[5] = {};
+    uint64_t rawValues2[5] = {};
+    uint32_t active1[5] = {};
+    uint32_t active2[5] = {};
+    double physicalValues1[5] = {};
+    double physicalValues2[5] = {};
+    for (uint32_t m : { m1, m2 }) {
+        Vector::DBC::MessageDecoder messageDecoder(network.messages[compiledNetwork.messageIds[m]]);
+        for (uint32_t i = 0; i < 100; ++i) {
+            for (auto & byte : data)
+                byte = rand() % 0x100;
+            data[0] %= 3;
+            for (std::size_t size : { std::size_t(compiledNetwork.messageSizes[m]), std::size_t(5) }) {
+                std::size_t count = compiledNetwork.decode(m, data.data(), size, rawValues1, active1);
+                BOOST_REQUIRE_EQUAL(count, messageDecoder.decode(data.data(), size, rawValues2, active2));
+                compiledNetwork.decodePhysical(m, data.data(), size, physicalValues1);
+                messageDecoder.decodePhysical(data.data(), size, physicalValues2);
+                for (std::size_t a = 0; a < count; ++a) {
+                    BOOST_CHECK_EQUAL(active1[a], active2[a]);
+                    BOOST_CHECK_EQUAL(rawValues1[active1[a]], rawValues2[active2[a]]);
+                    BOOST_CHECK_EQUAL(physicalValues1[active1[a]], physicalValues2[active2[a]]);
+                }
+            }
+        }
+    }
+
+    /* encode as MessageEncoder does */
+    Vector::DBC::MessageEncoder messageEncoder(network, message2);
+    compiledNetwork.initFrame(m2, data.data(), data.size());
+    BOOST_CHECK(data == messageEncoder.frame());
+    compiledNetwork.encodePhysical(m2, 0, data.data(), data.size(), 21.0);
+    compiledNetwork.encode(m2, 1, data.data(), data.size(), 0x5A);
+    messageEncoder.setPhysicalValue(0, 21.0);
+    messageEncoder.setRawValue(1, 0x5A);
+    BOOST_CHECK(data == messageEncoder.frame());
+    std::vector<uint8_t> largeFrame(16, 0xFF);
+    compiledNetwork.initFrame(m2, largeFrame.data(), largeFrame.size());
+    BOOST_CHECK(std::equal(largeFrame.begin(), largeFrame.begin() + 12, messageEncoder.frameTemplate.begin()));
+    BOOST_CHECK(std::all_of(largeFrame.begin() + 12, largeFrame.end(), [](uint8_t byte) {
+        return byte == 0;
+    }));
+
+    /* value descriptions, negative values are sign extended */
+    BOOST_CHECK(compiledNetwork.valueDescription(m1, 4, 1) == "On");
+    BOOST_CHECK(compiledNetwork.valueDescription(m1, 4, uint64_t(-1)) == "Invalid");
+    BOOST_CHECK(compiledNetwork.valueDescription(m1, 4, 2).data == nullptr);
+    BOOST_CHECK(compiledNetwork.valueDescription(m1, 4, 0x100000001).data == nullptr);
+    BOOST_CHECK(compiledNetwork.valueDescription(m1, 1, 1).data == nullptr);
+    BOOST_REQUIRE(compiledNetwork.findValue(m1, 4, "On") != nullptr);
+    BOOST_CHECK_EQUAL(*compiledNetwork.findValue(m1, 4, "On"), 1);
+    BOOST_CHECK(compiledNetwork.findValue(m1, 1, "On") == nullptr);
+
+    /* signals are found by their key in Message::signals */
+    message2.signals["signal_1"].name = "signal_3";
+    Vector::DBC::CompiledNetwork renamedNetwork(network);
+    BOOST_CHECK_EQUAL(renamedNetwork.findSignal(m2, "signal_1"), 0);
+    BOOST_CHECK_EQUAL(renamedNetwork.findSignal(m2, "signal_2"), 1);
+    BOOST_CHECK_EQUAL(renamedNetwork.findSignal(m2, "signal_3"), Vector::DBC::CompiledNetwork::notFound);
+}
+
+/**
+ * Check the symbol table.
+ */
+BOOST_AUTO_TEST_CASE(SymbolTable) {
+    Vector::DBC::SymbolTable symbols;
+    BOOST_CHECK_EQUAL(symbols.size(), 0);
+    BOOST_CHECK_EQUAL(symbols.find("ECU"), Vector::DBC::SymbolTable::notFound);
+
+    /* ids in order of first insertion, equal strings share the id */
+    BOOST_CHECK_EQUAL(symbols.insert("ECU"), 0);
+    BOOST_CHECK_EQUAL(symbols.insert(""), 1);
+    BOOST_CHECK_EQUAL(symbols.insert(std::string("ECU")), 0);
+    BOOST_CHECK_EQUAL(symbols.size(), 2);
+    BOOST_CHECK(symbols.string(0) == "ECU");
+    BOOST_CHECK(symbols.string(1).empty());
+    BOOST_CHECK_EQUAL(symbols.find(""), 1);
+
+    /* growth */
+    for (uint32_t i = 0; i < 1000; ++i)
+        BOOST_CHECK_EQUAL(symbols.insert("symbol_" + std::to_string(i)), 2 + i);
+    BOOST_CHECK_EQUAL(symbols.size(), 1002);
+    for (uint32_t i = 0; i < 1000; ++i) {
+        BOOST_CHECK_EQUAL(symbols.find("symbol_" + std::to_string(i)), 2 + i);
+        BOOST_CHECK(symbols.string(2 + i) == "symbol_" + std::to_string(i));
+    }
+    BOOST_CHECK_EQUAL(symbols.find("symbol_1000"), Vector::DBC::SymbolTable::notFound);
+    BOOST_CHECK_EQUAL(std::strlen(symbols.string(5).data), symbols.string(5).size);
+}
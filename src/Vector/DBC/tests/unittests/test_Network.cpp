@@ -0,0 +1,381 @@
+#define BOOST_TEST_MODULE Network
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Vector/DBC.h>
+
+/**
+ * Check the memory usage accounting.
+ */
+BOOST_AUTO_TEST_CASE(MemoryUsage) {
+    Vector::DBC::Network network;
+
+    /* empty network */
+    Vector::DBC::MemoryUsage memoryUsage = network.memoryUsage();
+    BOOST_CHECK_EQUAL(memoryUsage.other, sizeof(Vector::DBC::Network));
+    BOOST_CHECK_EQUAL(memoryUsage.total(), sizeof(Vector::DBC::Network));
+
+    /* message with a long name, a comment, a signal and an attribute */
+    Vector::DBC::Message & message = network.messages[0x100];
+    message.name = std::string(100, 'm');
+    message.comment = std::string(200, 'c');
+    Vector::DBC::Signal & signal = message.signals["signal"];
+    signal.name = "signal";
+    signal.valueDescriptions[0] = std::string(50, 'v');
+    signal.attributeValues["GenSigStartValue"].name = "GenSigStartValue";
+    memoryUsage = network.memoryUsage();
+    BOOST_CHECK_GE(memoryUsage.messages, sizeof(Vector::DBC::Message) + 101);
+    BOOST_CHECK_GE(memoryUsage.comments, 201);
+    BOOST_CHECK_LT(memoryUsage.comments, 201 + 64);
+    BOOST_CHECK_GE(memoryUsage.signals, sizeof(Vector::DBC::Signal));
+    BOOST_CHECK_GE(memoryUsage.valueDescriptions, 51);
+    BOOST_CHECK_GE(memoryUsage.attributeValues, sizeof(Vector::DBC::Attribute) + 17);
+    BOOST_CHECK_EQUAL(memoryUsage.environmentVariables, 0);
+    BOOST_CHECK_EQUAL(memoryUsage.nodes, 0);
+    /* four tree nodes (message, signal, value description, attribute value) with implementation defined links */
+    BOOST_CHECK_GE(memoryUsage.containerOverhead, 4 * 3 * sizeof(void *));
+    BOOST_CHECK_LE(memoryUsage.containerOverhead, 4 * 8 * sizeof(void *));
+    BOOST_CHECK_EQUAL(memoryUsage.total(),
+        memoryUsage.messages + memoryUsage.signals + memoryUsage.attributeValues +
+        memoryUsage.attributeDefinitions + memoryUsage.comments + memoryUsage.valueDescriptions +
+        memoryUsage.environmentVariables + memoryUsage.nodes + memoryUsage.other + memoryUsage.containerOverhead);
+
+    /* more signals use more memory */
+    std::size_t signals = memoryUsage.signals;
+    message.signals["signal_2"].receivers = { "ECU" };
+    memoryUsage = network.memoryUsage();
+    BOOST_CHECK_GE(memoryUsage.signals, signals + sizeof(Vector::DBC::Signal) + sizeof(std::string));
+
+    /* environment variables and nodes */
+    network.environmentVariables["envVar"].name = "envVar";
+    network.nodes["ECU"].name = "ECU";
+    memoryUsage = network.memoryUsage();
+    BOOST_CHECK_GE(memoryUsage.environmentVariables, sizeof(Vector::DBC::EnvironmentVariable));
+    BOOST_CHECK_GE(memoryUsage.nodes, sizeof(Vector::DBC::Node));
+}
+
+/**
+ * Check the reverse relation indices.
+ */
+BOOST_AUTO_TEST_CASE(RelationIndex) {
+    Vector::DBC::Network network;
+    Vector::DBC::Message & message1 = network.messages[0x100];
+    message1.transmitter = "ECU_1";
+    message1.transmitters = { "ECU_1", "ECU_2" };
+    message1.signals["signal_1"].receivers = { "ECU_2", "ECU_3" };
+    message1.signals["signal_2"].receivers = { "ECU_3" };
+    Vector::DBC::Message & message2 = network.messages[0x200];
+    message2.transmitter = "ECU_2";
+    message2.signals["signal_3"].receivers = { "ECU_3" };
+    network.environmentVariables["envVar_1"].accessNodes = { "ECU_1" };
+    network.environmentVariables["envVar_2"].accessNodes = { "ECU_1", "ECU_3" };
+
+    /* transmitters, BO_TX_BU duplicates are merged */
+    Vector::DBC::RelationIndex relationIndex(network);
+    BOOST_CHECK(!relationIndex.transmittedMessagesBuilt);
+    BOOST_REQUIRE_EQUAL(relationIndex.messagesTransmittedBy("ECU_1").size(), 1);
+    BOOST_CHECK(relationIndex.messagesTransmittedBy("ECU_1")[0] == &message1);
+    BOOST_REQUIRE_EQUAL(relationIndex.messagesTransmittedBy("ECU_2").size(), 2);
+    BOOST_CHECK(relationIndex.messagesTransmittedBy("ECU_2")[0] == &message1);
+    BOOST_CHECK(relationIndex.messagesTransmittedBy("ECU_2")[1] == &message2);
+    BOOST_CHECK(relationIndex.messagesTransmittedBy("ECU_3").empty());
+    BOOST_CHECK(relationIndex.transmittedMessagesBuilt);
+    BOOST_CHECK(!relationIndex.receivedSignalsBuilt);
+
+    /* receivers */
+    BOOST_REQUIRE_EQUAL(relationIndex.signalsReceivedBy("ECU_3").size(), 3);
+    BOOST_CHECK(relationIndex.signalsReceivedBy("ECU_3")[0].message == &message1);
+    BOOST_CHECK(relationIndex.signalsReceivedBy("ECU_3")[0].signal == &message1.signals["signal_1"]);
+    BOOST_CHECK(relationIndex.signalsReceivedBy("ECU_3")[2].signal == &message2.signals["signal_3"]);
+    BOOST_REQUIRE_EQUAL(relationIndex.messagesReceivedBy("ECU_3").size(), 2);
+    BOOST_REQUIRE_EQUAL(relationIndex.messagesReceivedBy("ECU_2").size(), 1);
+    BOOST_CHECK(relationIndex.messagesReceivedBy("ECU_2")[0] == &message1);
+    BOOST_CHECK(relationIndex.signalsReceivedBy("ECU_1").empty());
+
+    /* environment variables */
+    BOOST_CHECK_EQUAL(relationIndex.environmentVariablesAccessedBy("ECU_1").size(), 2);
+    BOOST_REQUIRE_EQUAL(relationIndex.environmentVariablesAccessedBy("ECU_3").size(), 1);
+    BOOST_CHECK_EQUAL(relationIndex.environmentVariablesAccessedBy("ECU_3")[0]->accessNodes.size(), 2);
+    BOOST_CHECK(relationIndex.environmentVariablesAccessedBy("ECU_2").empty());
+
+    /* rebuild after changes */
+    message2.transmitter = "ECU_3";
+    BOOST_CHECK_EQUAL(relationIndex.messagesTransmittedBy("ECU_3").size(), 0);
+    relationIndex.clear();
+    BOOST_CHECK_EQUAL(relationIndex.messagesTransmittedBy("ECU_3").size(), 1);
+    BOOST_CHECK_EQUAL(relationIndex.messagesTransmittedBy("ECU_2").size(), 1);
+}
+
+/**
+ * Check the typed attribute values with defaults applied.
+ */
+BOOST_AUTO_TEST_CASE(AttributeResolver) {
+    Vector::DBC::Network network;
+    Vector::DBC::AttributeDefinition & cycleTime = network.attributeDefinitions["GenMsgCycleTime"];
+    cycleTime.name = "GenMsgCycleTime";
+    cycleTime.objectType = Vector::DBC::AttributeObjectType::Message;
+    cycleTime.valueType.type = Vector::DBC::AttributeValueType::Type::Int;
+    network.attributeDefaults["GenMsgCycleTime"].integerValue = 100;
+    Vector::DBC::AttributeDefinition & sendType = network.attributeDefinitions["GenMsgSendType"];
+    sendType.name = "GenMsgSendType";
+    sendType.objectType = Vector::DBC::AttributeObjectType::Message;
+    sendType.valueType.type = Vector::DBC::AttributeValueType::Type::Enum;
+    sendType.valueType.enumValues = { "Cyclic", "Spontaneous" };
+    network.attributeDefaults["GenMsgSendType"].stringValue = "Spontaneous";
+    Vector::DBC::AttributeDefinition & startValue = network.attributeDefinitions["GenSigStartValue"];
+    startValue.name = "GenSigStartValue";
+    startValue.objectType = Vector::DBC::AttributeObjectType::Signal;
+    startValue.valueType.type = Vector::DBC::AttributeValueType::Type::Float;
+    Vector::DBC::AttributeDefinition & busType = network.attributeDefinitions["BusType"];
+    busType.name = "BusType";
+    busType.objectType = Vector::DBC::AttributeObjectType::Network;
+    busType.valueType.type = Vector::DBC::AttributeValueType::Type::String;
+    network.attributeValues["BusType"].stringValue = "CAN FD";
+
+    /* messages and signals with and without values */
+    Vector::DBC::Message & message1 = network.messages[0x100];
+    message1.attributeValues["GenMsgCycleTime"].integerValue = 10;
+    message1.attributeValues["GenMsgSendType"].enumValue = 0;
+    message1.signals["signal_1"].attributeValues["GenSigStartValue"].floatValue = 2.5;
+    message1.signals["signal_2"];
+    Vector::DBC::Message & message2 = network.messages[0x200];
+    message2.signals["signal_3"].attributeValues["GenSigStartValue"].floatValue = -1.0;
+
+    Vector::DBC::AttributeResolver attributeResolver(network);
+    uint32_t cycleTimeId = attributeResolver.attributeId("GenMsgCycleTime");
+    uint32_t sendTypeId = attributeResolver.attributeId("GenMsgSendType");
+    uint32_t startValueId = attributeResolver.attributeId("GenSigStartValue");
+    uint32_t busTypeId = attributeResolver.attributeId("BusType");
+    BOOST_CHECK_EQUAL(attributeResolver.attributeId("Unknown"), Vector::DBC::AttributeResolver::notFound);
+    uint32_t message1Index = attributeResolver.messageIndex(0x100);
+    uint32_t message2Index = attributeResolver.messageIndex(0x200);
+    BOOST_CHECK_EQUAL(message1Index, 0);
+    BOOST_CHECK_EQUAL(message2Index, 1);
+    BOOST_CHECK_EQUAL(attributeResolver.signalIndex(0x100, "signal_2"), 1);
+    BOOST_CHECK_EQUAL(attributeResolver.signalIndex(0x200, "signal_3"), 2);
+    BOOST_CHECK_EQUAL(attributeResolver.signalIndex(0x200, "signal_1"), Vector::DBC::AttributeResolver::notFound);
+
+    /* values and defaults */
+    BOOST_CHECK_EQUAL(attributeResolver.integerValue(cycleTimeId, message1Index), 10);
+    BOOST_CHECK(!attributeResolver.value(cycleTimeId, message1Index).isDefault);
+    BOOST_CHECK_EQUAL(attributeResolver.integerValue(cycleTimeId, message2Index), 100);
+    BOOST_CHECK(attributeResolver.value(cycleTimeId, message2Index).isDefault);
+    BOOST_CHECK_EQUAL(attributeResolver.floatValue(cycleTimeId, message2Index), 100.0);
+
+    /* enums, defaults are stored by name */
+    BOOST_CHECK_EQUAL(attributeResolver.integerValue(sendTypeId, message1Index), 0);
+    BOOST_CHECK_EQUAL(attributeResolver.stringValue(sendTypeId, message1Index), "Cyclic");
+    BOOST_CHECK_EQUAL(attributeResolver.integerValue(sendTypeId, message2Index), 1);
+    BOOST_CHECK_EQUAL(attributeResolver.stringValue(sendTypeId, message2Index), "Spontaneous");
+
+    /* floats without default */
+    BOOST_CHECK_EQUAL(attributeResolver.floatValue(startValueId, 0), 2.5);
+    BOOST_CHECK(!attributeResolver.value(startValueId, 1).defined);
+    BOOST_CHECK_EQUAL(attributeResolver.floatValue(startValueId, 1), 0.0);
+    BOOST_CHECK_EQUAL(attributeResolver.floatValue(startValueId, 2), -1.0);
+    BOOST_CHECK_EQUAL(attributeResolver.integerValue(startValueId, 2), -1);
+
+    /* strings */
+    BOOST_CHECK_EQUAL(attributeResolver.stringValue(busTypeId, 0), "CAN FD");
+    BOOST_CHECK(attributeResolver.stringValue(cycleTimeId, 0).data == nullptr);
+    BOOST_CHECK(!attributeResolver.value(Vector::DBC::AttributeResolver::notFound, 0).defined);
+}
+
+/**
+ * Check the columnar attribute storage and its round trip.
+ */
+BOOST_AUTO_TEST_CASE(AttributeTable) {
+    Vector::DBC::Network network;
+    Vector::DBC::AttributeDefinition & sendType = network.attributeDefinitions["GenMsgSendType"];
+    sendType.name = "GenMsgSendType";
+    sendType.objectType = Vector::DBC::AttributeObjectType::Message;
+    sendType.valueType.type = Vector::DBC::AttributeValueType::Type::Enum;
+    sendType.valueType.enumValues = { "Cyclic", "Spontaneous" };
+    network.attributeDefaults["GenMsgSendType"].name = "GenMsgSendType";
+    network.attributeDefaults["GenMsgSendType"].stringValue = "Cyclic";
+    Vector::DBC::AttributeDefinition & startValue = network.attributeDefinitions["GenSigStartValue"];
+    startValue.name = "GenSigStartValue";
+    startValue.objectType = Vector::DBC::AttributeObjectType::Signal;
+    startValue.valueType.type = Vector::DBC::AttributeValueType::Type::Float;
+    Vector::DBC::AttributeDefinition & nodeLayer = network.attributeDefinitions["NodeLayerModules"];
+    nodeLayer.name = "NodeLayerModules";
+    nodeLayer.objectType = Vector::DBC::AttributeObjectType::Node;
+    nodeLayer.valueType.type = Vector::DBC::AttributeValueType::Type::String;
+    Vector::DBC::AttributeDefinition & baudrate = network.attributeDefinitions["Baudrate"];
+    baudrate.name = "Baudrate";
+    baudrate.objectType = Vector::DBC::AttributeObjectType::Network;
+    baudrate.valueType.type = Vector::DBC::AttributeValueType::Type::Int;
+    network.attributeValues["Baudrate"].name = "Baudrate";
+    network.attributeValues["Baudrate"].integerValue = 500000;
+    network.nodes["ECU_1"].name = "ECU_1";
+    network.nodes["ECU_1"].attributeValues["NodeLayerModules"].name = "NodeLayerModules";
+    network.nodes["ECU_1"].attributeValues["NodeLayerModules"].stringValue = "CANoeILNVector.dll";
+    network.nodes["ECU_2"].name = "ECU_2";
+    for (uint32_t id = 0; id < 10; ++id) {
+        Vector::DBC::Message & message = network.messages[id];
+        message.id = id;
+        message.name = "message_" + std::to_string(id);
+        if (id % 3 == 0) {
+            message.attributeValues["GenMsgSendType"].name = "GenMsgSendType";
+            message.attributeValues["GenMsgSendType"].enumValue = 1;
+        }
+        Vector::DBC::Signal & signal = message.signals["signal"];
+        signal.name = "signal";
+        signal.attributeValues["GenSigStartValue"].name = "GenSigStartValue";
+        signal.attributeValues["GenSigStartValue"].floatValue = id * 0.5;
+    }
+    std::ostringstream before;
+    before << network;
+
+    /* extract */
+    Vector::DBC::AttributeTable attributeTable;
+    attributeTable.extract(network);
+    BOOST_CHECK(network.attributeValues.empty());
+    BOOST_CHECK(network.nodes["ECU_1"].attributeValues.empty());
+    BOOST_CHECK(network.messages[0].attributeValues.empty());
+    BOOST_CHECK(network.messages[0].signals["signal"].attributeValues.empty());
+    BOOST_CHECK_EQUAL(attributeTable.columns.size(), 4);
+    BOOST_CHECK_EQUAL(attributeTable.objectCounts[static_cast<std::size_t>(Vector::DBC::AttributeObjectType::Message)], 10);
+
+    /* lookup */
+    uint32_t sendTypeColumn = attributeTable.findColumn("GenMsgSendType", Vector::DBC::AttributeObjectType::Message);
+    BOOST_REQUIRE_NE(sendTypeColumn, Vector::DBC::AttributeTable::notFound);
+    BOOST_CHECK_EQUAL(attributeTable.columns[sendTypeColumn].findRow(3), 1);
+    BOOST_CHECK_EQUAL(attributeTable.columns[sendTypeColumn].findRow(4), Vector::DBC::AttributeTable::notFound);
+    BOOST_CHECK_EQUAL(attributeTable.findColumn("GenMsgSendType", Vector::DBC::AttributeObjectType::Signal), Vector::DBC::AttributeTable::notFound);
+    uint32_t startValueColumn = attributeTable.findColumn("GenSigStartValue", Vector::DBC::AttributeObjectType::Signal);
+    BOOST_REQUIRE_NE(startValueColumn, Vector::DBC::AttributeTable::notFound);
+    BOOST_CHECK_EQUAL(attributeTable.columns[startValueColumn].floatValues[7], 3.5);
+
+    /* scans, objects without value have the default */
+    BOOST_CHECK(attributeTable.select(sendTypeColumn, "Spontaneous") == std::vector<uint32_t>({ 0, 3, 6, 9 }));
+    BOOST_CHECK(attributeTable.select(sendTypeColumn, "Cyclic") == std::vector<uint32_t>({ 1, 2, 4, 5, 7, 8 }));
+    BOOST_CHECK(attributeTable.select(sendTypeColumn, 1) == std::vector<uint32_t>({ 0, 3, 6, 9 }));
+    BOOST_CHECK(attributeTable.select(sendTypeColumn, "Unknown").empty());
+    uint32_t nodeLayerColumn = attributeTable.findColumn("NodeLayerModules", Vector::DBC::AttributeObjectType::Node);
+    BOOST_CHECK(attributeTable.select(nodeLayerColumn, "CANoeILNVector.dll") == std::vector<uint32_t>({ 0 }));
+    BOOST_CHECK(attributeTable.select(nodeLayerColumn, "").empty());
+    uint32_t baudrateColumn = attributeTable.findColumn("Baudrate", Vector::DBC::AttributeObjectType::Network);
+    BOOST_CHECK(attributeTable.select(baudrateColumn, 500000) == std::vector<uint32_t>({ 0 }));
+
+    /* round trip */
+    attributeTable.restore(network);
+    BOOST_CHECK(attributeTable.columns.empty());
+    std::ostringstream after;
+    after << network;
+    BOOST_CHECK_EQUAL(before.str(), after.str());
+    BOOST_CHECK_EQUAL(network.messages[3].attributeValues["GenMsgSendType"].enumValue, 1);
+    BOOST_CHECK(network.messages[3].attributeValues["GenMsgSendType"].objectType == Vector::DBC::AttributeObjectType::Message);
+}
+
+/**
+ * Check the line of a parse error after each token that can contain newlines:
+ * strings, empty lines, comments and the new symbol lines, with LF and CRLF.
+ */
+BOOST_AUTO_TEST_CASE(ParseErrorLocation) {
+    const std::vector<std::pair<std::string, std::string>> databases {
+        { "VERSION \"1\n2\"\n\n\n;", "Parse error at 5." },
+        { "// comment\r\nVERSION \"1\r\n2\"\r\n\r\n;", "Parse error at 5." },
+        { "VERSION \"\"\r\n\r\nNS_ :\r\n\tCM_\r\n\r\n:", "Parse error at 6." }
+    };
+    for (const auto & database : databases) {
+        std::ostringstream errors;
+        std::streambuf * cerrBuffer = std::cerr.rdbuf(errors.rdbuf());
+        Vector::DBC::Network network;
+        network.load(database.first.data(), database.first.size());
+        std::cerr.rdbuf(cerrBuffer);
+        BOOST_CHECK(!network.successfullyParsed);
+        BOOST_CHECK_EQUAL(errors.str().find(database.second), 0);
+    }
+}
+
+/**
+ * Check that attribute values on relations of the same attribute are kept and indexed.
+ */
+BOOST_AUTO_TEST_CASE(AttributeRelationIndex) {
+    Vector::DBC::Network network;
+    Vector::DBC::AttributeDefinition & gatewayed = network.attributeDefinitions["GenSigGatewayed"];
+    gatewayed.name = "GenSigGatewayed";
+    gatewayed.objectType = Vector::DBC::AttributeObjectType::NodeMappedRxSignal;
+    gatewayed.valueType.type = Vector::DBC::AttributeValueType::Type::Int;
+    Vector::DBC::AttributeDefinition & txDelay = network.attributeDefinitions["GenMsgTxDelay"];
+    txDelay.name = "GenMsgTxDelay";
+    txDelay.objectType = Vector::DBC::AttributeObjectType::NodeTxMessage;
+    txDelay.valueType.type = Vector::DBC::AttributeValueType::Type::Int;
+    for (uint32_t id = 0; id < 100; ++id) {
+        Vector::DBC::AttributeRelation attributeRelation;
+        attributeRelation.name = "GenSigGatewayed";
+        attributeRelation.objectType = Vector::DBC::AttributeObjectType::NodeMappedRxSignal;
+        attributeRelation.nodeName = (id % 2) ? "ECU_1" : "ECU_2";
+        attributeRelation.messageId = id;
+        attributeRelation.signalName = "signal";
+        attributeRelation.integerValue = id;
+        network.attributeRelationValues[Vector::DBC::AttributeRelationKey(attributeRelation)] = attributeRelation;
+        attributeRelation.name = "GenMsgTxDelay";
+        attributeRelation.objectType = Vector::DBC::AttributeObjectType::NodeTxMessage;
+        attributeRelation.signalName.clear();
+        attributeRelation.integerValue = 2 * id;
+        network.attributeRelationValues[Vector::DBC::AttributeRelationKey(attributeRelation)] = attributeRelation;
+    }
+    BOOST_CHECK_EQUAL(network.attributeRelationValues.size(), 200);
+
+    /* all values are written */
+    std::ostringstream os;
+    os << network;
+    BOOST_CHECK_NE(os.str().find("BA_REL_ \"GenSigGatewayed\" BU_SG_REL_ ECU_2 SG_ 0 signal 0;"), std::string::npos);
+    BOOST_CHECK_NE(os.str().find("BA_REL_ \"GenSigGatewayed\" BU_SG_REL_ ECU_1 SG_ 99 signal 99;"), std::string::npos);
+    BOOST_CHECK_NE(os.str().find("BA_REL_ \"GenMsgTxDelay\" BU_BO_REL_ ECU_1 51 102;"), std::string::npos);
+
+    /* lookup */
+    Vector::DBC::AttributeRelationIndex attributeRelationIndex(network);
+    BOOST_CHECK_EQUAL(attributeRelationIndex.slotCount, 200);
+    const Vector::DBC::AttributeRelation * attributeRelation = attributeRelationIndex.findNodeMappedRxSignal("GenSigGatewayed", "ECU_1", 51, "signal");
+    BOOST_REQUIRE(attributeRelation);
+    BOOST_CHECK_EQUAL(attributeRelation->integerValue, 51);
+    attributeRelation = attributeRelationIndex.findNodeTxMessage("GenMsgTxDelay", "ECU_2", 50);
+    BOOST_REQUIRE(attributeRelation);
+    BOOST_CHECK_EQUAL(attributeRelation->integerValue, 100);
+    BOOST_CHECK(!attributeRelationIndex.findNodeMappedRxSignal("GenSigGatewayed", "ECU_2", 51, "signal"));
+    BOOST_CHECK(!attributeRelationIndex.findNodeMappedRxSignal("GenSigGatewayed", "ECU_1", 51, "other"));
+    BOOST_CHECK(!attributeRelationIndex.findNodeTxMessage("GenSigGatewayed", "ECU_1", 51));
+    BOOST_CHECK(!attributeRelationIndex.findControlUnitEnvironmentVariable("GenMsgTxDelay", "ECU_1", "envVar"));
+
+    /* values are edited in place and stay indexed */
+    Vector::DBC::AttributeRelationKey key;
+    key.name = "GenMsgTxDelay";
+    key.objectType = Vector::DBC::AttributeObjectType::NodeTxMessage;
+    key.nodeName = "ECU_2";
+    key.messageId = 50;
+    BOOST_REQUIRE_EQUAL(network.attributeRelationValues.count(key), 1);
+    network.attributeRelationValues.at(key).integerValue = 1000;
+    BOOST_CHECK_EQUAL(attributeRelationIndex.findNodeTxMessage("GenMsgTxDelay", "ECU_2", 50)->integerValue, 1000);
+
+    /* other object types are keyed by name only, as in operator< */
+    Vector::DBC::AttributeRelation networkRelation1;
+    networkRelation1.name = "NetworkAttribute";
+    networkRelation1.objectType = Vector::DBC::AttributeObjectType::Network;
+    networkRelation1.nodeName = "ECU_1";
+    Vector::DBC::AttributeRelation networkRelation2 = networkRelation1;
+    networkRelation2.nodeName = "ECU_2";
+    BOOST_CHECK(!(networkRelation1 < networkRelation2) && !(networkRelation2 < networkRelation1));
+    Vector::DBC::AttributeRelationKey networkKey1(networkRelation1);
+    Vector::DBC::AttributeRelationKey networkKey2(networkRelation2);
+    BOOST_CHECK(!(networkKey1 < networkKey2) && !(networkKey2 < networkKey1));
+    attributeRelationIndex.insert(networkRelation1);
+    attributeRelationIndex.insert(networkRelation2);
+    BOOST_CHECK_EQUAL(attributeRelationIndex.slotCount, 201);
+    BOOST_CHECK(attributeRelationIndex.find("NetworkAttribute", Vector::DBC::AttributeObjectType::Network, "ECU_3", "", 0, "") == &networkRelation2);
+
+    /* empty index */
+    Vector::DBC::AttributeRelationIndex emptyIndex;
+    BOOST_CHECK(!emptyIndex.findNodeTxMessage("GenMsgTxDelay", "ECU_2", 50));
+}
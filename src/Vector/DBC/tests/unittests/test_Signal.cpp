@@ -4,6 +4,8 @@
 #endif
 #include <boost/test/unit_test.hpp>
 
+#include <cmath>
+#include <cstring>
 #include <fstream>
 #include <iterator>
 #include <limits>
@@ -43,6 +45,20 @@ BOOST_AUTO_TEST_CASE(SignalRawPhysicalMinMax) {
     signal.valueType = Vector::DBC::ValueType::Unsigned;
     BOOST_CHECK_EQUAL(signal.minimumRawValue(), 0.0);
     BOOST_CHECK_EQUAL(signal.maximumRawValue(), 65535.0);
+    // integer above 32 bits
+    signal.bitSize = 40;
+    signal.valueType = Vector::DBC::ValueType::Signed;
+    BOOST_CHECK_EQUAL(signal.minimumRawValue(), -549755813888.0);
+    BOOST_CHECK_EQUAL(signal.maximumRawValue(), 549755813887.0);
+    signal.valueType = Vector::DBC::ValueType::Unsigned;
+    BOOST_CHECK_EQUAL(signal.minimumRawValue(), 0.0);
+    BOOST_CHECK_EQUAL(signal.maximumRawValue(), 1099511627775.0);
+    signal.bitSize = 64;
+    BOOST_CHECK_EQUAL(signal.maximumRawValue(), 18446744073709551615.0);
+    // invalid bit size
+    signal.bitSize = 0;
+    BOOST_CHECK_EQUAL(signal.minimumRawValue(), 0.0);
+    BOOST_CHECK_EQUAL(signal.maximumRawValue(), 0.0);
     // float
     signal.bitSize = 32;
     signal.extendedValueType = Vector::DBC::Signal::ExtendedValueType::Float;
@@ -139,3 +155,307 @@ BOOST_AUTO_TEST_CASE(BothFunctionsCombined) {
     physicalValue = signal.rawToPhysicalValue(rawValue);
     BOOST_CHECK_EQUAL(physicalValue, 116.75);
 }
+
+/**
+ * Bit by bit reference implementation of decode.
+ *
+ * This is the algorithm Signal::decode used before the extraction plan.
+ * The sign check uses a 64-bit shift, as the former int shift was
+ * undefined for signals with more than 32 bits.
+ */
+static uint64_t referenceDecode(const Vector::DBC::Signal & signal, const std::vector<uint8_t> & data) {
+    uint64_t retVal = 0;
+    unsigned int srcBit = signal.startBit;
+    for (uint32_t i = 0; i < signal.bitSize; ++i) {
+        unsigned int dstBit = (signal.byteOrder == Vector::DBC::ByteOrder::BigEndian) ? signal.bitSize - 1 - i : i;
+        if (data[srcBit / 8] & (1 << (srcBit % 8)))
+            retVal |= (1ULL << dstBit);
+        if (signal.byteOrder == Vector::DBC::ByteOrder::LittleEndian)
+            ++srcBit;
+        else if ((srcBit % 8) == 0)
+            srcBit += 15;
+        else
+            --srcBit;
+    }
+    if ((signal.valueType == Vector::DBC::ValueType::Signed) && (retVal & (1ULL << (signal.bitSize - 1)))) {
+        for (auto i = signal.bitSize; i < 64; ++i)
+            retVal |= (1ULL << i);
+    }
+    return retVal;
+}
+
+/**
+ * Bit by bit reference implementation of encode.
+ */
+static void referenceEncode(const Vector::DBC::Signal & signal, std::vector<uint8_t> & data, uint64_t rawValue) {
+    unsigned int srcBit = signal.startBit;
+    for (uint32_t i = 0; i < signal.bitSize; ++i) {
+        unsigned int dstBit = (signal.byteOrder == Vector::DBC::ByteOrder::BigEndian) ? signal.bitSize - 1 - i : i;
+        if (rawValue & (1ULL << dstBit))
+            data[srcBit / 8] |= (1 << (srcBit % 8));
+        else
+            data[srcBit / 8] &= ~(1 << (srcBit % 8));
+        if (signal.byteOrder == Vector::DBC::ByteOrder::LittleEndian)
+            ++srcBit;
+        else if ((srcBit % 8) == 0)
+            srcBit += 15;
+        else
+            --srcBit;
+    }
+}
+
+/**
+ * Check that the extraction plan is bit-identical to the bit by bit
+ * algorithm for every startBit/bitSize/byteOrder/valueType combination
+ * that fits into a 64 byte CAN FD frame.
+ */
+BOOST_AUTO_TEST_CASE(SignalLayoutEquivalence) {
+    const std::size_t frameSize = 64;
+    uint64_t seed = 0x0123456789ABCDEFULL;
+    auto random = [&seed]() {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        return seed;
+    };
+
+    for (auto byteOrder : { Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ByteOrder::LittleEndian }) {
+        for (auto valueType : { Vector::DBC::ValueType::Unsigned, Vector::DBC::ValueType::Signed }) {
+            for (uint32_t startBit = 0; startBit < 8 * frameSize; ++startBit) {
+                for (uint32_t bitSize = 1; bitSize <= 64; ++bitSize) {
+                    /* skip signals not fitting into the frame */
+                    uint32_t lastBit = (byteOrder == Vector::DBC::ByteOrder::LittleEndian) ?
+                                       startBit + bitSize - 1 :
+                                       (startBit / 8) * 8 + 7 - (startBit % 8) + bitSize - 1;
+                    if (lastBit >= 8 * frameSize)
+                        continue;
+
+                    Vector::DBC::Signal signal;
+                    signal.startBit = startBit;
+                    signal.bitSize = bitSize;
+                    signal.byteOrder = byteOrder;
+                    signal.valueType = valueType;
+
+                    for (int pattern = 0; pattern < 4; ++pattern) {
+                        std::vector<uint8_t> data(frameSize);
+                        for (auto & byte : data)
+                            byte = (pattern == 0) ? 0x00 : (pattern == 1) ? 0xFF : uint8_t(random() >> 56);
+
+                        /* decode */
+                        uint64_t expected = referenceDecode(signal, data);
+                        uint64_t actual = signal.decode(data);
+                        if (actual != expected)
+                            BOOST_FAIL("decode mismatch at startBit=" << startBit << " bitSize=" << bitSize
+                                       << " byteOrder=" << char(byteOrder) << " valueType=" << char(valueType));
+
+                        /* unchecked decode reads only the byte span */
+                        Vector::DBC::SignalLayout layout = signal.layout();
+                        std::vector<uint8_t> span(data.begin(), data.begin() + layout.byteOffset + layout.byteCount);
+                        if (layout.decodeSpan(span.data()) != expected)
+                            BOOST_FAIL("span decode mismatch at startBit=" << startBit << " bitSize=" << bitSize
+                                       << " byteOrder=" << char(byteOrder) << " valueType=" << char(valueType));
+
+                        /* encode */
+                        uint64_t rawValue = random();
+                        std::vector<uint8_t> expectedData = data;
+                        referenceEncode(signal, expectedData, rawValue);
+                        signal.encode(data, rawValue);
+                        if (data != expectedData)
+                            BOOST_FAIL("encode mismatch at startBit=" << startBit << " bitSize=" << bitSize
+                                       << " byteOrder=" << char(byteOrder) << " valueType=" << char(valueType));
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Check that decode/encode don't access data beyond the frame size.
+ */
+BOOST_AUTO_TEST_CASE(SignalLayoutShortFrame) {
+    Vector::DBC::Signal signal;
+    signal.startBit = 12;
+    signal.bitSize = 16;
+    signal.byteOrder = Vector::DBC::ByteOrder::LittleEndian;
+    signal.valueType = Vector::DBC::ValueType::Unsigned;
+
+    /* only the first two bytes are available, missing bits read as zero */
+    std::vector<uint8_t> data { 0x00, 0xA0 };
+    BOOST_CHECK_EQUAL(signal.decode(data), 0x0A);
+
+    /* only the available bits are written */
+    signal.encode(data, 0xFFFF);
+    BOOST_CHECK_EQUAL(data.size(), 2);
+    BOOST_CHECK_EQUAL(data[0], 0x00);
+    BOOST_CHECK_EQUAL(data[1], 0xF0);
+}
+
+/**
+ * Check that decode follows changes of the signal layout.
+ */
+BOOST_AUTO_TEST_CASE(SignalLayoutUpdate) {
+    Vector::DBC::Signal signal;
+    signal.startBit = 8;
+    signal.bitSize = 8;
+    signal.byteOrder = Vector::DBC::ByteOrder::LittleEndian;
+    signal.valueType = Vector::DBC::ValueType::Unsigned;
+    std::vector<uint8_t> data { 0x12, 0x34, 0x56 };
+    BOOST_CHECK_EQUAL(signal.decode(data), 0x34);
+
+    /* changed start bit */
+    signal.startBit = 16;
+    BOOST_CHECK_EQUAL(signal.layout().byteOffset, 2);
+    BOOST_CHECK_EQUAL(signal.decode(data), 0x56);
+}
+
+/**
+ * Check physical decoding of integer, float and double signals.
+ */
+BOOST_AUTO_TEST_CASE(SignalDecodePhysical) {
+    Vector::DBC::Signal signal;
+    signal.byteOrder = Vector::DBC::ByteOrder::LittleEndian;
+    signal.factor = 2.0;
+    signal.offset = 1.0;
+    std::vector<uint8_t> data(8);
+
+    /* signed integer */
+    signal.startBit = 0;
+    signal.bitSize = 8;
+    signal.valueType = Vector::DBC::ValueType::Signed;
+    signal.encode(data, 0xFE);
+    BOOST_CHECK_EQUAL(signal.decodePhysical(data), -3.0);
+
+    /* unsigned integer */
+    signal.valueType = Vector::DBC::ValueType::Unsigned;
+    BOOST_CHECK_EQUAL(signal.decodePhysical(data), 509.0);
+
+    /* float, the value type is irrelevant */
+    float floatValue = -1.25f;
+    uint32_t floatBits;
+    std::memcpy(&floatBits, &floatValue, sizeof(floatBits));
+    signal.startBit = 32;
+    signal.bitSize = 32;
+    signal.valueType = Vector::DBC::ValueType::Signed;
+    signal.extendedValueType = Vector::DBC::Signal::ExtendedValueType::Float;
+    signal.encode(data, floatBits);
+    BOOST_CHECK_EQUAL(signal.decodePhysical(data), -1.5);
+
+    /* double */
+    double doubleValue = 1.0e100;
+    uint64_t doubleBits;
+    std::memcpy(&doubleBits, &doubleValue, sizeof(doubleBits));
+    signal.startBit = 0;
+    signal.bitSize = 64;
+    signal.extendedValueType = Vector::DBC::Signal::ExtendedValueType::Double;
+    signal.encode(data, doubleBits);
+    BOOST_CHECK_EQUAL(signal.decodePhysical(data), 2.0e100 + 1.0);
+}
+
+/**
+ * Check that raw values are rounded and saturated to the range of the signal.
+ */
+BOOST_AUTO_TEST_CASE(SignalRawBits) {
+    Vector::DBC::Signal signal;
+    signal.bitSize = 8;
+
+    /* unsigned integer */
+    signal.valueType = Vector::DBC::ValueType::Unsigned;
+    Vector::DBC::SignalConversion conversion = signal.conversion();
+    BOOST_CHECK_EQUAL(conversion.rawBits(300.0), 255);
+    BOOST_CHECK_EQUAL(conversion.rawBits(255.4), 255);
+    BOOST_CHECK_EQUAL(conversion.rawBits(254.6), 255);
+    BOOST_CHECK_EQUAL(conversion.rawBits(-1.0), 0);
+    BOOST_CHECK_EQUAL(conversion.rawBits(std::nan("")), 0);
+
+    /* signed integer, sign extended */
+    signal.valueType = Vector::DBC::ValueType::Signed;
+    conversion = signal.conversion();
+    BOOST_CHECK_EQUAL(conversion.rawBits(300.0), 127);
+    BOOST_CHECK_EQUAL(conversion.rawBits(-300.0), uint64_t(-128));
+    BOOST_CHECK_EQUAL(conversion.rawBits(-128.0), uint64_t(-128));
+    BOOST_CHECK_EQUAL(conversion.rawBits(-1.0), uint64_t(-1));
+
+    /* 64 bits */
+    signal.bitSize = 64;
+    conversion = signal.conversion();
+    BOOST_CHECK_EQUAL(conversion.rawBits(1.0e30), uint64_t(std::numeric_limits<int64_t>::max()));
+    BOOST_CHECK_EQUAL(conversion.rawBits(-1.0e30), uint64_t(std::numeric_limits<int64_t>::min()));
+    signal.valueType = Vector::DBC::ValueType::Unsigned;
+    conversion = signal.conversion();
+    BOOST_CHECK_EQUAL(conversion.rawBits(1.0e30), std::numeric_limits<uint64_t>::max());
+    BOOST_CHECK_EQUAL(conversion.rawBits(9007199254740992.0), 9007199254740992ULL);
+
+    /* encoded with the physical value */
+    signal.bitSize = 8;
+    signal.byteOrder = Vector::DBC::ByteOrder::LittleEndian;
+    signal.factor = 0.5;
+    std::vector<uint8_t> data(1);
+    signal.encode(data, signal.conversion().physicalToRawBits(200.0));
+    BOOST_CHECK_EQUAL(data[0], 0xFF);
+}
+
+/**
+ * Check the shared value description store.
+ */
+BOOST_AUTO_TEST_CASE(ValueDescriptionStore) {
+    Vector::DBC::Network network;
+    Vector::DBC::ValueDescriptions onOff { { 0, "Off" }, { 1, "On" }, { 3, "Error" } };
+    Vector::DBC::ValueDescriptions sparse { { 5, "Five" }, { 1000, "Thousand" }, { 70000, "Off" }, { 80000, "Off" } };
+    network.valueTables["OnOff"].valueDescriptions = onOff;
+    Vector::DBC::Message & message = network.messages[0x100];
+    message.signals["signal_1"].valueDescriptions = onOff;
+    message.signals["signal_2"].valueDescriptions = sparse;
+    message.signals["signal_3"];
+    network.environmentVariables["envVar"].valueDescriptions = onOff;
+    Vector::DBC::ValueDescriptionStore store(network);
+
+    /* identical value descriptions share one table */
+    BOOST_CHECK_EQUAL(store.tables.size(), 2);
+    const uint32_t onOffTable = store.valueTables["OnOff"];
+    BOOST_CHECK_EQUAL(store.signalTable(0x100, 0), onOffTable);
+    BOOST_CHECK_EQUAL(store.environmentVariableTables["envVar"], onOffTable);
+    const uint32_t sparseTable = store.signalTable(0x100, 1);
+    BOOST_CHECK_NE(sparseTable, onOffTable);
+    BOOST_CHECK_EQUAL(store.signalTable(0x100, 2), Vector::DBC::ValueDescriptionStore::noTable);
+    BOOST_CHECK_EQUAL(store.signalTable(0x200, 0), Vector::DBC::ValueDescriptionStore::noTable);
+    BOOST_CHECK_EQUAL(store.insert(sparse), sparseTable);
+
+    /* dense table */
+    BOOST_CHECK_EQUAL(store.tables[onOffTable].slotCount, 4);
+    BOOST_CHECK(store.findDescription(onOffTable, 0) == "Off");
+    BOOST_CHECK(store.findDescription(onOffTable, 3) == "Error");
+    BOOST_CHECK(store.findDescription(onOffTable, 2).data == nullptr);
+    BOOST_CHECK(store.findDescription(onOffTable, 4).data == nullptr);
+
+    /* sorted table */
+    BOOST_CHECK_EQUAL(store.tables[sparseTable].slotCount, 0);
+    BOOST_CHECK(store.findDescription(sparseTable, 1000) == "Thousand");
+    BOOST_CHECK(store.findDescription(sparseTable, 70000) == "Off");
+    BOOST_CHECK(store.findDescription(sparseTable, 6).data == nullptr);
+    BOOST_CHECK(store.findDescription(Vector::DBC::ValueDescriptionStore::noTable, 0).data == nullptr);
+
+    /* reverse lookup is per table, duplicate descriptions give the lowest value */
+    BOOST_REQUIRE(store.findValue(onOffTable, "Off") != nullptr);
+    BOOST_CHECK_EQUAL(*store.findValue(onOffTable, "Off"), 0);
+    BOOST_REQUIRE(store.findValue(sparseTable, "Off") != nullptr);
+    BOOST_CHECK_EQUAL(*store.findValue(sparseTable, "Off"), 70000);
+    BOOST_CHECK_EQUAL(*store.findValue(sparseTable, std::string("Thousand")), 1000);
+    BOOST_CHECK(store.findValue(onOffTable, "Thousand") == nullptr);
+    BOOST_CHECK(store.findValue(onOffTable, "") == nullptr);
+
+    /* empty descriptions are found */
+    uint32_t emptyTable = store.insert(Vector::DBC::ValueDescriptions { { 7, "" } });
+    BOOST_CHECK(store.findDescription(emptyTable, 7).data != nullptr);
+    BOOST_CHECK(store.findDescription(emptyTable, 7).empty());
+    BOOST_REQUIRE(store.findValue(emptyTable, "") != nullptr);
+    BOOST_CHECK_EQUAL(*store.findValue(emptyTable, ""), 7);
+
+    /* reverse index grows */
+    for (uint32_t t = 0; t < 100; ++t) {
+        Vector::DBC::ValueDescriptions valueDescriptions;
+        for (uint32_t v = 0; v < 10; ++v)
+            valueDescriptions[v * t] = "value_" + std::to_string(v * t);
+        uint32_t table = store.insert(valueDescriptions);
+        BOOST_CHECK_EQUAL(*store.findValue(table, "value_" + std::to_string(9 * t)), 9 * t);
+    }
+    BOOST_CHECK_EQUAL(*store.findValue(sparseTable, "Five"), 5);
+}
@@ -0,0 +1,108 @@
+#define BOOST_TEST_MODULE SignalCodec
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+#include <Vector/DBC.h>
+
+/** frame size of the test matrix, large enough for all combinations */
+static const std::size_t frameSize = 24;
+
+/** list of compile-time values */
+template<uint32_t... Values>
+struct List {};
+
+/** start bits of the test matrix */
+using StartBits = List<0, 1, 7, 8, 13, 31, 32, 55, 63, 64, 71>;
+
+/** bit sizes of the test matrix */
+using BitSizes = List<1, 4, 8, 12, 16, 31, 32, 33, 52, 57, 58, 63, 64>;
+
+/** pseudo random numbers */
+static uint64_t randomValue() {
+    static uint64_t seed = 0x0123456789ABCDEFULL;
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return seed;
+}
+
+/** entry of the test matrix */
+struct MatrixEntry {
+    uint32_t startBit;
+    uint32_t bitSize;
+    Vector::DBC::ByteOrder byteOrder;
+    Vector::DBC::ValueType valueType;
+    uint64_t (*decode)(const uint8_t * data);
+    void (*encode)(uint8_t * data, uint64_t rawValue);
+};
+
+template<uint32_t StartBit, uint32_t BitSize, Vector::DBC::ByteOrder Order, Vector::DBC::ValueType Type>
+static MatrixEntry matrixEntry() {
+    using Codec = Vector::DBC::SignalCodec<StartBit, BitSize, Order, Type>;
+    return { StartBit, BitSize, Order, Type, &Codec::decode, &Codec::encode };
+}
+
+template<Vector::DBC::ByteOrder Order, Vector::DBC::ValueType Type, uint32_t StartBit, uint32_t... Sizes>
+static void addStartBit(std::vector<MatrixEntry> & matrix, List<Sizes...>) {
+    matrix.insert(matrix.end(), { matrixEntry<StartBit, Sizes, Order, Type>()... });
+}
+
+template<Vector::DBC::ByteOrder Order, Vector::DBC::ValueType Type, uint32_t... Starts>
+static void addMatrix(std::vector<MatrixEntry> & matrix, List<Starts...>) {
+    (void) std::initializer_list<int> { (addStartBit<Order, Type, Starts>(matrix, BitSizes()), 0)... };
+}
+
+/**
+ * Check the codecs against the runtime Signal implementation on random data.
+ */
+BOOST_AUTO_TEST_CASE(SignalCodecMatrix) {
+    std::vector<MatrixEntry> matrix;
+    addMatrix<Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned>(matrix, StartBits());
+    addMatrix<Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Signed>(matrix, StartBits());
+    addMatrix<Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Unsigned>(matrix, StartBits());
+    addMatrix<Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Signed>(matrix, StartBits());
+
+    for (const auto & entry : matrix) {
+        Vector::DBC::Signal signal;
+        signal.startBit = entry.startBit;
+        signal.bitSize = entry.bitSize;
+        signal.byteOrder = entry.byteOrder;
+        signal.valueType = entry.valueType;
+
+        for (int i = 0; i < 8; ++i) {
+            std::vector<uint8_t> data(frameSize);
+            for (auto & byte : data)
+                byte = uint8_t(randomValue() >> 56);
+
+            /* decode */
+            if (entry.decode(data.data()) != signal.decode(data))
+                BOOST_FAIL("decode mismatch at startBit=" << entry.startBit << " bitSize=" << entry.bitSize
+                           << " byteOrder=" << char(entry.byteOrder) << " valueType=" << char(entry.valueType));
+
+            /* encode */
+            uint64_t rawValue = randomValue();
+            std::vector<uint8_t> expectedData = data;
+            signal.encode(expectedData, rawValue);
+            entry.encode(data.data(), rawValue);
+            if (data != expectedData)
+                BOOST_FAIL("encode mismatch at startBit=" << entry.startBit << " bitSize=" << entry.bitSize
+                           << " byteOrder=" << char(entry.byteOrder) << " valueType=" << char(entry.valueType));
+        }
+    }
+}
+
+/**
+ * Check that decode/encode are usable in constant expressions.
+ */
+BOOST_AUTO_TEST_CASE(SignalCodecConstexpr) {
+    using Codec = Vector::DBC::SignalCodec<1, 4, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Signed>;
+    constexpr uint8_t negative[] = { 0x10 }; // xxx1000x
+    constexpr uint8_t positive[] = { 0x0E }; // xxx0111x
+    static_assert(Codec::decode(negative) == 0xFFFFFFFFFFFFFFF8, "constexpr decode");
+    static_assert(Codec::decode(positive) == 0x07, "constexpr decode");
+    BOOST_CHECK_EQUAL(Codec::byteCount, 1);
+}